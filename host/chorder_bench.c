@@ -0,0 +1,520 @@
+/* Host benchmark for the chord/HID core. Measures what a chord costs to
+ * decode and hand to the (mocked) HID layer, plus the helpers on the
+ * note-taking path, so regressions show up before flashing.
+ *
+ * Usage: chorder_bench [iterations]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "chorder_handlers.h"
+#include "chorder_debounce.h"
+#include "chorder_keyscan.h"
+#include "chorder_keyring.h"
+#include "chorder_actions.h"
+#include "chorder_snippets.h"
+#include "chorder_dict.h"
+#include "chorder_taphold.h"
+#include "chorder_typematic.h"
+#include "chorder_advisor.h"
+#include "chorder_locale.h"
+#include "chorder_unicode.h"
+#include "chorder_usage.h"
+#include "dict_build.h"
+#include "hid_dev.h"
+#include "chorder_display.h"
+#include "mock_idf.h"
+#include "soc/gpio_reg.h"
+
+extern TFT_t dev;
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void report(const char *name, double elapsed_ns, unsigned long ops)
+{
+  printf("%-34s %10lu ops %10.1f ns/op\n", name, ops, elapsed_ns / ops);
+}
+
+// Runs every chord from 0x01 to 0x7F through a keystate handler:
+static void bench_keystate_handler(const char *name, void (*handler)(uint8_t), unsigned iterations)
+{
+  uint32_t reports_before = mock_hid_report_count;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    for (uint8_t keyState = 1; keyState < 128; keyState++)
+      handler(keyState);
+  }
+  report(name, now_ns() - start, (unsigned long) iterations * 127);
+  printf("%-34s %10.2f HID reports/chord\n", "",
+      (double) (mock_hid_report_count - reports_before) / ((double) iterations * 127));
+}
+
+static volatile uint16_t symbol_sink;
+static void sink_symbol(uint16_t symbol)
+{
+  symbol_sink = symbol;
+}
+static void internal_with_sink(uint8_t keyState)
+{
+  handle_keystate_update_internally(keyState, &sink_symbol);
+}
+
+static void bench_layers(unsigned iterations)
+{
+  layer_stack_t ls = LAYER_STACK_INIT(KEYMAP_ALPHA);
+  layers_push(&ls, KEYMAP_NUMSYM, LAYER_LOCKED, 0);
+
+  volatile symbol_t sink = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    for (uint8_t keyState = 1; keyState < 128; keyState++)
+      sink = layers_lookup(&ls, keyState);
+  }
+  report("layers_lookup", now_ns() - start, (unsigned long) iterations * 127);
+
+  start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    layers_oneshot_toggle(&ls, KEYMAP_FUNCTION);
+    sink = layers_lookup(&ls, i & 0x7F);
+    layers_key_sent(&ls);
+  }
+  report("layer one-shot+lookup+key sent", now_ns() - start, iterations);
+  (void) sink;
+}
+
+// Runs every symbol with an action through the interpreter, as well as a
+// plain key, so the cost of the table-driven dispatch shows up on its own:
+static void bench_actions(unsigned iterations)
+{
+  layer_stack_t ls = LAYER_STACK_INIT(KEYMAP_ALPHA);
+  uint32_t reports_before = mock_hid_report_count;
+  unsigned long ops = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    for (symbol_t symbol = DIV_nonkeys_offset; symbol < DIV_Last; symbol++) {
+      if (actions_execute(&ls, symbol))
+        layers_key_sent(&ls);
+    }
+    actions_execute(&ls, HID_KEY_A);
+    ops += DIV_Last - DIV_nonkeys_offset + 1;
+  }
+  report("actions_execute", now_ns() - start, ops);
+  printf("%-34s %10.2f HID reports/action\n", "",
+      (double) (mock_hid_report_count - reports_before) / ops);
+}
+
+static void bench_snippet(unsigned iterations)
+{
+  char text[4096];
+  for (size_t i = 0; i < sizeof(text) - 1; i++)
+    text[i] = "The quick brown fox, jumps over the lazy dog!\n"[i % 46];
+  text[sizeof(text) - 1] = '\0';
+
+  uint32_t reports_before = mock_hid_report_count;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++)
+    snippet_stream(text);
+  report("snippet_stream (4095 chars)", now_ns() - start, iterations);
+  printf("%-34s %10.2f HID reports/char\n", "",
+      (double) (mock_hid_report_count - reports_before) / ((double) iterations * (sizeof(text) - 1)));
+}
+
+/* Streams text with every character each locale types (twice over, and with
+ * runs of repeated keys) through the report packer. chorder_tests checks that
+ * the host types it back intact.
+ */
+static void bench_keyreport(unsigned iterations)
+{
+  static char text[32768];
+  for (uint8_t id = 0; id < LOCALES; id++) {
+    locale_select(id);
+    size_t len = 0;
+    for (int pass = 0; pass < 2; pass++) {
+      for (int c = 1; c < 128; c++)
+        text[len++] = c;
+      for (uint16_t i = 0; i < active_locale->extras_len; i++) {
+        uint16_t cp = active_locale->extras[i].codepoint;
+        if (cp < 0x800) {
+          text[len++] = 0xC0 | cp >> 6;
+        } else {
+          text[len++] = 0xE0 | cp >> 12;
+          text[len++] = 0x80 | ((cp >> 6) & 0x3F);
+        }
+        text[len++] = 0x80 | (cp & 0x3F);
+      }
+      len += sprintf(text + len, "aaa  bookkeeper, Mississippi!! %s", snippet_texts[1]);
+    }
+    text[len] = '\0';
+    size_t chars = 0;
+    for (const char *c = text; c < text + len; ) {
+      uint32_t codepoint = locale_utf8_next(&c, text + len - c);
+      chars += NULL != locale_lookup(codepoint);
+    }
+
+    uint32_t reports_before = mock_hid_report_count;
+    double start = now_ns();
+    for (unsigned i = 0; i < iterations; i++)
+      snippet_stream(text);
+    double elapsed = now_ns() - start;
+    double reports = (double) (mock_hid_report_count - reports_before) / iterations;
+
+    char name[48];
+    snprintf(name, sizeof(name), "keyreport packing (%s, %zu chars)", active_locale->name, chars);
+    report(name, elapsed, iterations);
+    printf("%-34s %10.2f HID reports/char\n", "", reports / chars);
+  }
+  locale_select(LOCALE_US);
+}
+
+// Looking up mixed text, mostly ASCII, in each locale:
+static void bench_locale(unsigned iterations)
+{
+  static const char text[] = "Grüße aus Århus, où l'été dure: «déjà vu» coûte 5 €!\n";
+  for (uint8_t id = 0; id < LOCALES; id++) {
+    locale_select(id);
+    unsigned chars = 0, typable = 0, dead = 0;
+    double start = now_ns();
+    for (unsigned i = 0; i < iterations; i++) {
+      for (const char *c = text; c < text + sizeof(text) - 1; chars++) {
+        const locale_stroke_t *stroke = locale_lookup(locale_utf8_next(&c, text + sizeof(text) - 1 - c));
+        typable += NULL != stroke;
+        dead += NULL != stroke && 0 != stroke->dead_key;
+      }
+    }
+    char name[48];
+    snprintf(name, sizeof(name), "locale_lookup (%s)", active_locale->name);
+    report(name, now_ns() - start, chars);
+    printf("%-34s %10.1f%% typable, %.1f%% with dead keys\n", "", 100.0 * typable / chars, 100.0 * dead / chars);
+  }
+  locale_select(LOCALE_US);
+}
+
+// Turns code points into reports for each input method, in each locale
+// (chorder_tests checks that they're entered back intact):
+static void bench_unicode(unsigned iterations)
+{
+  static const char *const names[UNICODE_METHODS] = { "none", "Linux", "macOS", "Windows" };
+  for (uint8_t method = UNICODE_LINUX; method < UNICODE_METHODS; method++) {
+    unicode_select(method);
+    for (uint8_t id = 0; id < LOCALES; id++) {
+      locale_select(id);
+      unicode_report_t sequence[UNICODE_MAX_REPORTS];
+      // Across the BMP, and beyond it every other time, with every hex digit
+      // turning up:
+#define BENCH_CODEPOINT(i) (0xA0 + (uint32_t) ((i) * 2654435761UL % ((i) & 1 ? 0x10FF60 : 0xFF60)))
+      unsigned long chars = iterations, reports = 0, typable = 0;
+      double start = now_ns();
+      for (unsigned i = 0; i < iterations; i++) {
+        size_t count = unicode_reports(BENCH_CODEPOINT(i), sequence);
+        typable += 0 != count;
+        reports += count;
+      }
+      double elapsed = now_ns() - start;
+#undef BENCH_CODEPOINT
+      char name[48];
+      snprintf(name, sizeof(name), "unicode_reports (%s, %s)", names[method], active_locale->name);
+      report(name, elapsed, chars);
+      printf("%-34s %10.1f%% typable, %.1f reports/char\n", "",
+          100.0 * typable / chars, typable ? (double) reports / typable : 0.0);
+    }
+  }
+  unicode_select(UNICODE_NONE);
+  locale_select(LOCALE_US);
+}
+
+/* Builds a dictionary of 100k distinct random outlines, of one to four
+ * strokes, and strokes through a stream of them. Also looks up outlines that
+ * aren't in there, as most of the lookups made while extending translations
+ * are:
+ */
+#define BENCH_DICT_ENTRIES 100000
+#define BENCH_DICT_SLOTS   (1 << 18)
+static void bench_dictionary(unsigned iterations)
+{
+  static dict_entry_t entries[BENCH_DICT_ENTRIES];
+  static char words[BENCH_DICT_ENTRIES][12];
+  // Outlines drawn so far, by hash, for drawing again on a repeat:
+  static int32_t drawn[BENCH_DICT_SLOTS];
+  memset(drawn, 0xFF, sizeof(drawn));
+  srand(1);
+  for (int i = 0; i < BENCH_DICT_ENTRIES; i++) {
+    dict_entry_t *entry = &entries[i];
+    uint32_t slot;
+    do {
+      entry->nstrokes = 1 + rand() % 4;
+      for (int s = 0; s < entry->nstrokes; s++)
+        entry->strokes[s] = 1 + rand() % 127;
+      slot = dict_hash(entry->strokes, entry->nstrokes) % BENCH_DICT_SLOTS;
+      while (-1 != drawn[slot] && (entries[drawn[slot]].nstrokes != entry->nstrokes
+            || 0 != memcmp(entries[drawn[slot]].strokes, entry->strokes, entry->nstrokes)))
+        slot = (slot + 1) % BENCH_DICT_SLOTS;
+    } while (-1 != drawn[slot]);
+    drawn[slot] = i;
+    entry->text_len = 3 + rand() % 8;
+    for (int c = 0; c < entry->text_len - 1; c++)
+      words[i][c] = 'a' + rand() % 26;
+    words[i][entry->text_len - 1] = ' ';
+    entry->text = words[i];
+  }
+  size_t size;
+  uint8_t *blob = dict_build(entries, BENCH_DICT_ENTRIES, &size);
+  dictionary_t d = { 0 };
+  dict_attach(&d, blob, size);
+
+  const char *text;
+  uint8_t text_len;
+  volatile unsigned found = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    const dict_entry_t *entry = &entries[(i * 7919) % BENCH_DICT_ENTRIES];
+    found += dict_lookup(&d, entry->strokes, entry->nstrokes, &text, &text_len);
+  }
+  report("dict_lookup (hit, 100k outlines)", now_ns() - start, iterations);
+
+  uint8_t missing[DICT_MAX_STROKES] = { 1, 2, 3, 4, 5, 6 };
+  start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    missing[0] = 1 + i % 127;
+    missing[1] = 1 + (i >> 7) % 127;
+    found += dict_lookup(&d, missing, 6, &text, &text_len);
+  }
+  report("dict_lookup (miss, 100k outlines)", now_ns() - start, iterations);
+
+  d.stats = (dict_stats_t) { 0 };
+  dict_output_t out;
+  unsigned long strokes = 0;
+  start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    const dict_entry_t *entry = &entries[(i * 7919) % BENCH_DICT_ENTRIES];
+    for (int s = 0; s < entry->nstrokes; s++)
+      found += dict_stroke(&d, entry->strokes[s], 1, &out);
+    strokes += entry->nstrokes;
+  }
+  report("dict_stroke (100k outlines)", now_ns() - start, strokes);
+  printf("%-34s %10.2f lookups/stroke %6.2f probes/lookup\n", "",
+      (double) d.stats.lookups / d.stats.strokes, (double) d.stats.probes / d.stats.lookups);
+  printf("%-34s %10.1f%% translated, %u bytes\n", "",
+      100.0 * d.stats.translations / d.stats.strokes, (unsigned) size);
+  (void) found;
+  free(blob);
+}
+
+/* The decoder's extra work per key event, and per wake-up, for tap-hold:
+ * holding F, tapping I with it held, letting go, then tapping F.
+ */
+static void bench_taphold(unsigned iterations)
+{
+  static const uint8_t states[] = { 0x40, 0x48, 0x40, 0x00, 0x40, 0x00 };
+  taphold_t th;
+  taphold_init(&th, 200000);
+
+  volatile uint8_t sink = 0;
+  uint8_t released;
+  int64_t now = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    for (size_t j = 0; j < sizeof(states); j++) {
+      sink = taphold_feed(&th, states[j], now, &released);
+      now += 0 == j ? 300000 : 50000;
+      int64_t deadline = taphold_deadline(&th);
+      if (-1 != deadline && deadline <= now)
+        sink = taphold_resolve(&th, deadline);
+    }
+  }
+  (void) sink;
+  report("taphold feed+resolve", now_ns() - start, (unsigned long) iterations * sizeof(states));
+}
+
+// What following the chord held still costs each decoder wake-up, a repeat
+// every other time:
+static void bench_typematic(unsigned iterations)
+{
+  typematic_t tm;
+  typematic_init(&tm, 500000, 40000);
+  typematic_hold(&tm, 0x44, 0);
+  volatile bool sink = false;
+  int64_t now = 500000;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    typematic_hold(&tm, 0x44, 0);
+    sink = typematic_due(&tm, now);
+    now += 20000;
+  }
+  (void) sink;
+  report("typematic hold+due", now_ns() - start, iterations);
+  printf("%-34s %10.1f%% due\n", "", 100.0 * tm.typed / iterations);
+}
+
+static void bench_usage(unsigned iterations)
+{
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++)
+    usage_count(i % KEYMAP_LAYERS, 1 + (i * 37) % 127);
+  report("usage_count", now_ns() - start, iterations);
+
+  usage_load();
+  uint32_t writes_before = mock_nvs_writes;
+  unsigned flushes = iterations / 1000 ? iterations / 1000 : 1;
+  start = now_ns();
+  for (unsigned i = 0; i < flushes; i++) {
+    usage_count(KEYMAP_ALPHA, 1 + i % 127);
+    usage_flush();
+  }
+  report("usage_count+flush", now_ns() - start, flushes);
+  printf("%-34s %10.2f blobs written/flush\n", "",
+      (double) (mock_nvs_writes - writes_before) / flushes);
+}
+
+// What judging a transition adds to each commit (and each keyState) in the
+// decoder:
+static void bench_advisor(unsigned iterations)
+{
+  advisor_t a;
+  advisor_init(&a, 500000);
+  volatile uint8_t sink = 0;
+  int64_t now = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    sink = advisor_commit(&a, 1 + (i * 37) % 127, now);
+    advisor_keys(&a, i & 1 ? 0 : 0x06);
+    now += 100000;
+  }
+  (void) sink;
+  report("advisor commit+keys", now_ns() - start, iterations);
+  printf("%-34s %10.1f%% flagged\n", "", 100.0 * a.wasteful / a.judged);
+}
+
+static void bench_urlencode(unsigned iterations)
+{
+  char note[INTERNAL_BUFSIZE];
+  char encoded[2*INTERNAL_BUFSIZE];
+  for (size_t i = 0; i < sizeof(note) - 1; i++)
+    note[i] = "The quick brown fox, jumps over the lazy dog!\n"[i % 46];
+  note[sizeof(note) - 1] = '\0';
+
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++)
+    urlencode_into(encoded, sizeof(encoded), note);
+  report("urlencode_into (199 chars)", now_ns() - start, iterations);
+}
+
+static void bench_render_message(unsigned iterations)
+{
+  static FontxFile fx16[2];
+  lcdInit(&dev, CONFIG_WIDTH, CONFIG_HEIGHT, CONFIG_OFFSETX, CONFIG_OFFSETY);
+  InitFontx(fx16, CHORDER_FONT_DIR "/ILGH16XB.FNT", "");
+
+  unsigned char message[] = "Some note being typed,\nwrapping across lines on the display";
+  uint32_t transactions_before = mock_spi_transaction_count;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++)
+    render_message(fx16, WHITE, 0, 20, DIR_W_TO_E, message);
+  report("render_message (58 chars)", now_ns() - start, iterations);
+  printf("%-34s %10.1f SPI transactions/render\n", "",
+      (double) (mock_spi_transaction_count - transactions_before) / iterations);
+}
+
+/* The key scan as it was, a driver call per pin, against the one snapshot of
+ * the input registers main.c's get_current_state() takes now. On the host,
+ * gpio_get_level() is only a call and a register read; on the device it also
+ * goes through the HAL, so the gap there is if anything wider:
+ */
+static uint8_t keystate_per_pin(void)
+{
+  uint8_t state = 0;
+  state |= (!gpio_get_level(F_THUMB_PIN) << 6);
+  state |= (!gpio_get_level(C_THUMB_PIN) << 5);
+  state |= (!gpio_get_level(N_THUMB_PIN) << 4);
+  state |= (!gpio_get_level(INDEX_PIN)   << 3);
+  state |= (!gpio_get_level(MIDDLE_PIN)  << 2);
+  state |= (!gpio_get_level(RING_PIN)    << 1);
+  state |= (!gpio_get_level(PINKY_PIN)   << 0);
+  return state;
+}
+
+static void bench_keyscan(unsigned iterations)
+{
+  volatile uint8_t sink = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    mock_gpio_in_regs[0] = ~(i * 2654435761U);
+    sink = keystate_per_pin();
+  }
+  double per_pin = now_ns() - start;
+  report("key scan, gpio_get_level per pin", per_pin, iterations);
+
+  start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    mock_gpio_in_regs[0] = ~(i * 2654435761U);
+    sink = keystate_from_gpio_in(REG_READ(GPIO_IN_REG), REG_READ(GPIO_IN1_REG));
+  }
+  double snapshot = now_ns() - start;
+  report("key scan, register snapshot", snapshot, iterations);
+  printf("%-34s %10.1fx cheaper\n", "", per_pin / snapshot);
+  (void) sink;
+  mock_gpio_in_regs[0] = 0xffffffff;
+}
+
+static void bench_debounce(unsigned iterations)
+{
+  const int32_t windows[DEBOUNCE_KEYS] = { 10000, 10000, 10000, 10000, 10000, 10000, 10000 };
+  debouncer_t db;
+  debounce_init(&db, windows);
+
+  volatile uint8_t stable = 0;
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++)
+    stable = debounce_update(&db, (i >> 4) & 0x7F, NULL, (int64_t) i * 1000);
+  (void) stable;
+  report("debounce_update", now_ns() - start, iterations);
+}
+
+static void bench_keyring(unsigned iterations)
+{
+  static key_event_ring_t ring;
+  key_event_t event = { 0 };
+  double start = now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    event.keyState = i & 0x7F;
+    key_event_ring_push(&ring, &event);
+    key_event_ring_pop(&ring, &event);
+  }
+  report("key_event_ring push+pop", now_ns() - start, iterations);
+}
+
+int main(int argc, char **argv)
+{
+  unsigned iterations = argc > 1 ? (unsigned) atoi(argv[1]) : 10000;
+  mock_log_level = 1;
+  sec_conn = true;
+
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  bench_keystate_handler("ble keyboard handler", &handle_keystate_update_as_ble_keyboard, iterations);
+  bench_keystate_handler("keystate update internally", &internal_with_sink, iterations);
+  switch_to_opmode(OPMODE_BLE_MOUSE);
+  bench_keystate_handler("ble mouse handler", &handle_keystate_update_as_ble_mouse, iterations);
+  bench_layers(iterations * 10);
+  bench_actions(iterations);
+  bench_taphold(iterations * 100);
+  bench_typematic(iterations * 100);
+  bench_usage(iterations * 100);
+  bench_advisor(iterations * 100);
+  bench_snippet(iterations / 10 ? iterations / 10 : 1);
+  bench_keyreport(iterations / 10 ? iterations / 10 : 1);
+  bench_locale(iterations * 10);
+  bench_unicode(iterations * 10);
+  bench_dictionary(iterations * 100);
+  bench_urlencode(iterations);
+  bench_render_message(iterations / 10 ? iterations / 10 : 1);
+  bench_keyscan(iterations * 100);
+  bench_debounce(iterations * 100);
+  bench_keyring(iterations * 100);
+  return 0;
+}
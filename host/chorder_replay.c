@@ -0,0 +1,419 @@
+/* Replays raw keystate traces (as recorded with CONFIG_CHORDER_TRACE) through
+ * the debouncer and chord machine, and on into the note-taking symbol
+ * handler. Prints each committed chord, the symbol it produced and how long
+ * after its physical edge it was committed, followed by decode throughput.
+ *
+ * The scanner is simulated as when polling: each sample is a raw reading,
+ * and pending releases are picked up once their debounce window has passed.
+ * Operating mode switching chords are not acted upon.
+ *
+ * Usage: chorder_replay [-q] [-n repeats] [-d debounce_us] [-r rollover_us]
+ *                       [-s speculate_us] [-t hold_us]
+ *                       [-a delay_us] [-i interval_us] [-j jitter_us] [trace...]
+ *
+ * -r commits chords as per the rollover policy, rather than on first release.
+ * -s speculates on chords held still for that long, and reports how often
+ *    that would've been right and how much earlier the output would've been.
+ * -t resolves tap-hold chords held still for that long as holds, as in BLE
+ *    keyboard mode, and reports when each hold starts and lets go.
+ * -a repeats chords held still for that long (backspace, as in note-taking
+ *    mode) every interval, and reports how late the repeats went out and
+ *    the rate they went out at. -j wakes the decoder for each up to that
+ *    much late, at random, as a busy device might.
+ *
+ * Chords the transition advisor would flag are marked with the keys that
+ * could have been held over into them.
+ *
+ * Traces default to stdin, and may be whole console logs.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chorder_handlers.h"
+#include "chorder_debounce.h"
+#include "chorder_chord.h"
+#include "chorder_taphold.h"
+#include "chorder_typematic.h"
+#include "chorder_advisor.h"
+#include "chorder_trace.h"
+#include "mock_idf.h"
+#include "sdkconfig.h"
+
+typedef struct {
+  key_event_t *samples;
+  size_t count;
+  size_t capacity;
+} trace_t;
+
+typedef struct {
+  unsigned long chords;
+  unsigned long symbols;
+  int64_t delay_total;      // summed edge-to-commit delays
+  int64_t delay_max;
+  unsigned long speculations;
+  unsigned long speculation_hits;
+  int64_t speculation_gain;   // summed commit-to-speculation time of hits
+  unsigned long holds;
+  unsigned long dual_role_taps;
+  unsigned long advised;    // transitions the advisor flagged
+  unsigned long repeated;   // chords typed as held
+  unsigned long repeats;    // times they were typed, all told
+  int64_t repeat_late_total;  // summed due-to-typed times
+  int64_t repeat_late_max;
+  int64_t repeat_span;      // summed first-to-last repeat times
+} replay_stats_t;
+
+static bool quiet = false;
+static replay_stats_t stats;
+static bool taphold_enabled = false;
+static taphold_t taphold;
+static bool typematic_enabled = false;
+static typematic_t typematic;
+static int32_t wake_jitter_us = 0;
+// When the chord held was first and last typed:
+static int64_t typed_first_at, typed_last_at;
+
+// The chord last speculated on, and when, as the decoder would have:
+static uint8_t speculated_chord = 0;
+static int64_t speculated_at;
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void load_trace(trace_t *trace, FILE *in)
+{
+  char line[256];
+  key_event_t sample;
+  while (fgets(line, sizeof(line), in)) {
+    if (!trace_parse_line(line, &sample))
+      continue;
+    if (trace->count == trace->capacity) {
+      trace->capacity = trace->capacity ? 2 * trace->capacity : 1024;
+      trace->samples = realloc(trace->samples, trace->capacity * sizeof(*trace->samples));
+      if (NULL == trace->samples) {
+        perror("realloc");
+        exit(1);
+      }
+    }
+    trace->samples[trace->count++] = sample;
+  }
+}
+
+static void print_symbol(uint16_t symbol)
+{
+  stats.symbols++;
+  if (quiet)
+    return;
+  if ('\n' == symbol)
+    printf("  '\\n'");
+  else if (symbol >= 0x20 && symbol < 0x7F)
+    printf("  '%c'", (char) symbol);
+  else
+    printf("  <special %u>", symbol);
+}
+
+static void print_chord(uint8_t chord)
+{
+  printf("%c%c%c %c%c%c%c",
+      chord & (1 << 6) ? 'F' : '-',
+      chord & (1 << 5) ? 'C' : '-',
+      chord & (1 << 4) ? 'N' : '-',
+      chord & (1 << 3) ? 'I' : '-',
+      chord & (1 << 2) ? 'M' : '-',
+      chord & (1 << 1) ? 'R' : '-',
+      chord & (1 << 0) ? 'P' : '-');
+}
+
+static void print_hold(uint8_t chord, int64_t now, const char *what)
+{
+  if (quiet)
+    return;
+  printf("%12.3f ms  ", now / 1000.0);
+  print_chord(chord);
+  printf("  %s\n", what);
+}
+
+static void commit_chord(uint8_t chord, int64_t edge_time, int64_t commit_time)
+{
+  int64_t delay = commit_time - edge_time;
+  bool speculation_hit = 0 != speculated_chord && chord == speculated_chord;
+  stats.chords++;
+  if (speculation_hit) {
+    stats.speculation_hits++;
+    stats.speculation_gain += commit_time - speculated_at;
+  }
+  speculated_chord = 0;
+  stats.delay_total += delay;
+  if (delay > stats.delay_max)
+    stats.delay_max = delay;
+
+  if (taphold_enabled && taphold_is_dual_role(chord))
+    stats.dual_role_taps++;
+  uint8_t hint = advisor_commit(&advisor, chord, edge_time);
+  stats.advised += 0 != hint;
+
+  if (!quiet) {
+    printf("%12.3f ms  ", commit_time / 1000.0);
+    print_chord(chord);
+    printf("  +%6lld us", (long long) delay);
+    if (speculation_hit)
+      printf("  (speculated %+lld us)", (long long) (speculated_at - commit_time));
+    if (0 != hint) {
+      printf("  (could hold ");
+      print_chord(hint);
+      printf(" over)");
+    }
+  }
+  mock_idf_set_time(commit_time);
+  handle_keystate_update_internally(chord, &print_symbol);
+  if (!quiet)
+    putchar('\n');
+}
+
+static void feed_stable(chord_machine_t *cm, const debouncer_t *db, uint8_t previous, uint8_t stable, int64_t now)
+{
+  if (previous == stable)
+    return;
+  int64_t edge_time = debounce_last_activity(db, previous ^ stable);
+  uint8_t keyState = stable;
+  if (taphold_enabled) {
+    uint8_t released;
+    keyState = taphold_feed(&taphold, stable, edge_time, &released);
+    if (0 != released)
+      print_hold(released, now, "let go");
+  }
+  uint8_t chord = chord_machine_feed(cm, keyState, edge_time);
+  uint8_t typed = typematic_enabled ? typematic_hold(&typematic, 0, edge_time) : 0;
+  if (0 != typed) {
+    stats.repeated++;
+    stats.repeat_span += typed_last_at - typed_first_at;
+  }
+  // A chord typed as held isn't typed again as it's let go of:
+  if (0 != chord && chord == typed) {
+    stats.chords++;
+    print_hold(chord, now, "let go");
+  } else if (0 != chord) {
+    commit_chord(chord, edge_time, now);
+  }
+  handle_keys_held(stable);
+  advisor_keys(&advisor, keyState);
+}
+
+// When the decoder wakes up for a repeat due at deadline, jitter and all:
+static int64_t woken_for(int64_t deadline)
+{
+  static int64_t drawn_for = -1, woken_at;
+  if (deadline != drawn_for) {
+    drawn_for = deadline;
+    woken_at = deadline + (wake_jitter_us ? rand() % wake_jitter_us : 0);
+  }
+  return woken_at;
+}
+
+// Types the chord held still each time it's due up to now, as the decoder
+// would:
+static void repeat_until(const chord_machine_t *cm, int64_t now)
+{
+  uint8_t still = PRESSING == cm->state && typematic_applies(cm->previous) ? cm->previous : 0;
+  if (taphold_enabled && 0 != taphold.candidate)
+    still = 0;
+  typematic_hold(&typematic, still, cm->last_change);
+
+  int64_t deadline;
+  while (-1 != (deadline = typematic_deadline(&typematic)) && woken_for(deadline) <= now) {
+    int64_t woken_at = woken_for(deadline);
+    bool first = 0 == typematic.typed;
+    typematic_due(&typematic, woken_at);
+    int64_t late = woken_at - deadline;
+    stats.repeats++;
+    stats.repeat_late_total += late;
+    if (late > stats.repeat_late_max)
+      stats.repeat_late_max = late;
+    if (first)
+      typed_first_at = woken_at;
+    typed_last_at = woken_at;
+
+    if (!quiet) {
+      printf("%12.3f ms  ", woken_at / 1000.0);
+      print_chord(typematic.chord);
+      printf("  +%6lld us late", (long long) late);
+    }
+    if (first) {
+      mock_idf_set_time(woken_at);
+      handle_keystate_update_internally(typematic.chord, &print_symbol);
+    } else {
+      print_symbol(NONBLE_BACKSPACE);
+    }
+    if (!quiet)
+      putchar('\n');
+  }
+}
+
+// Speculates on the forming chord if it's been held still up to now, or
+// resolves it as a hold:
+static void speculate_until(chord_machine_t *cm, int64_t now)
+{
+  int64_t hold_at = taphold_enabled ? taphold_deadline(&taphold) : -1;
+  if (-1 != hold_at && hold_at <= now) {
+    uint8_t held = taphold_resolve(&taphold, hold_at);
+    chord_machine_restart(cm, 0, hold_at);
+    stats.holds++;
+    print_hold(held, hold_at, "held");
+  }
+  if (typematic_enabled)
+    repeat_until(cm, now);
+  if (taphold_enabled && 0 != taphold.candidate)
+    return;
+  if (typematic_enabled && 0 != typematic.typed)
+    return;
+  int64_t deadline = chord_machine_speculation_deadline(cm);
+  if (-1 == deadline || deadline > now)
+    return;
+  speculated_chord = chord_machine_speculate(cm, deadline);
+  speculated_at = deadline;
+  stats.speculations++;
+}
+
+static void replay(const trace_t *trace, int32_t debounce_us, chord_commit_policy_t policy, int32_t rollover_us, int32_t speculate_us, int32_t hold_us, int32_t delay_us, int32_t interval_us)
+{
+  taphold_init(&taphold, hold_us);
+  typematic_init(&typematic, delay_us, interval_us);
+  advisor_init(&advisor, CONFIG_CHORDER_ADVISOR_WINDOW_MS * 1000);
+  int32_t windows[DEBOUNCE_KEYS];
+  for (int i = 0; i < DEBOUNCE_KEYS; i++)
+    windows[i] = debounce_us;
+  debouncer_t db;
+  debounce_init(&db, windows);
+  chord_machine_t cm;
+  chord_machine_init(&cm, policy, rollover_us);
+  chord_machine_set_speculation(&cm, speculate_us);
+
+  uint8_t stable = 0;
+  for (size_t i = 0; i < trace->count; i++) {
+    const key_event_t *sample = &trace->samples[i];
+    // Releases that settled before this sample, as the scanner would've woken for:
+    int64_t settles_at;
+    while (-1 != (settles_at = debounce_next_deadline(&db)) && settles_at <= sample->timestamp) {
+      speculate_until(&cm, settles_at);
+      uint8_t next = debounce_update(&db, db.raw, NULL, settles_at);
+      feed_stable(&cm, &db, stable, next, settles_at);
+      stable = next;
+    }
+    speculate_until(&cm, sample->timestamp);
+    uint8_t next = debounce_update(&db, sample->keyState, NULL, sample->timestamp);
+    feed_stable(&cm, &db, stable, next, sample->timestamp);
+    stable = next;
+  }
+  int64_t settles_at;
+  while (-1 != (settles_at = debounce_next_deadline(&db))) {
+    speculate_until(&cm, settles_at);
+    uint8_t next = debounce_update(&db, db.raw, NULL, settles_at);
+    feed_stable(&cm, &db, stable, next, settles_at);
+    stable = next;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  unsigned repeats = 1;
+  int32_t debounce_us = CONFIG_CHORDER_DEBOUNCE_US;
+  chord_commit_policy_t policy = CHORD_COMMIT_FIRST_RELEASE;
+  int32_t rollover_us = 0;
+  int32_t speculate_us = 0;
+  int32_t hold_us = 0;
+  int32_t delay_us = 0;
+  int32_t interval_us = CONFIG_CHORDER_TYPEMATIC_INTERVAL_MS * 1000;
+  int opt;
+  while (-1 != (opt = getopt(argc, argv, "qn:d:r:s:t:a:i:j:"))) {
+    switch (opt) {
+      case 'q': quiet = true; break;
+      case 'n': repeats = (unsigned) atoi(optarg); break;
+      case 'd': debounce_us = atoi(optarg); break;
+      case 'r':
+        policy = CHORD_COMMIT_ROLLOVER;
+        rollover_us = atoi(optarg);
+        break;
+      case 's': speculate_us = atoi(optarg); break;
+      case 't':
+        taphold_enabled = true;
+        hold_us = atoi(optarg);
+        break;
+      case 'a':
+        typematic_enabled = true;
+        delay_us = atoi(optarg);
+        break;
+      case 'i': interval_us = atoi(optarg); break;
+      case 'j': wake_jitter_us = atoi(optarg); break;
+      default:
+        fprintf(stderr, "Usage: %s [-q] [-n repeats] [-d debounce_us] [-r rollover_us] [-s speculate_us] [-t hold_us] [-a delay_us] [-i interval_us] [-j jitter_us] [trace...]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (interval_us <= 0) {
+    fprintf(stderr, "The repeat interval must be positive\n");
+    return 2;
+  }
+  mock_log_level = 1;
+  // What repeats is as in note-taking mode:
+  keystate_handler = &handle_keystate_update_internally_with_printing;
+
+  trace_t trace = { 0 };
+  if (optind == argc) {
+    load_trace(&trace, stdin);
+  }
+  for (int i = optind; i < argc; i++) {
+    FILE *in = strcmp(argv[i], "-") ? fopen(argv[i], "r") : stdin;
+    if (NULL == in) {
+      perror(argv[i]);
+      return 1;
+    }
+    load_trace(&trace, in);
+    if (stdin != in)
+      fclose(in);
+  }
+  if (0 == trace.count) {
+    fprintf(stderr, "No trace samples found\n");
+    return 1;
+  }
+
+  double start = now_ns();
+  for (unsigned i = 0; i < repeats; i++) {
+    replay(&trace, debounce_us, policy, rollover_us, speculate_us, hold_us, delay_us, interval_us);
+    quiet = true;  // only ever print the first pass
+  }
+  double elapsed = now_ns() - start;
+
+  unsigned long samples = (unsigned long) trace.count * repeats;
+  printf("%lu samples, %lu chords, %lu symbols over %u pass(es)\n", samples, stats.chords, stats.symbols, repeats);
+  if (stats.chords)
+    printf("edge to commit: mean %lld us, max %lld us\n",
+        (long long) (stats.delay_total / (int64_t) stats.chords), (long long) stats.delay_max);
+  int64_t duration = trace.samples[trace.count - 1].timestamp - trace.samples[0].timestamp;
+  if (duration > 0)
+    printf("typing rate: %.1f chords/min\n", stats.chords / (double) repeats * 60e6 / duration);
+  if (stats.speculations)
+    printf("speculation: %lu sent ahead, %lu hits, %lu mispredicted (%.1f%%), hits %lld us early on average\n",
+        stats.speculations, stats.speculation_hits, stats.speculations - stats.speculation_hits,
+        100.0 * (stats.speculations - stats.speculation_hits) / stats.speculations,
+        (long long) (stats.speculation_hits ? stats.speculation_gain / (int64_t) stats.speculation_hits : 0));
+  if (taphold_enabled)
+    printf("tap-hold: %lu holds, %lu dual-role chords tapped\n", stats.holds, stats.dual_role_taps);
+  if (stats.repeats)
+    printf("typematic: %lu chords typed as held, %lu times; late by %lld us on average, %lld us at most\n",
+        stats.repeated, stats.repeats,
+        (long long) (stats.repeat_late_total / (int64_t) stats.repeats), (long long) stats.repeat_late_max);
+  if (stats.repeat_span > 0)
+    printf("typematic rate: %.2f/s, against %.2f/s configured\n",
+        (stats.repeats - stats.repeated) * 1e6 / stats.repeat_span, 1e6 / interval_us);
+  printf("advisor: %lu transitions could have held keys over\n", stats.advised);
+  printf("decode: %.1f ns/sample, %.2f Msamples/s\n", elapsed / samples, samples / elapsed * 1e3);
+  free(trace.samples);
+  return 0;
+}
@@ -0,0 +1,1253 @@
+/* Host tests for the chord/HID core, run through CTest:
+ *
+ *   cmake -S host -B host/build && cmake --build host/build
+ *   ctest --test-dir host/build --output-on-failure
+ *
+ * Each check that fails is printed with where it is; the exit status is
+ * non-zero if any did. Timing is left to chorder_bench.
+ *
+ * Usage: chorder_tests
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chorder_actions.h"
+#include "chorder_chord.h"
+#include "chorder_dict.h"
+#include "chorder_handlers.h"
+#include "chorder_snippets.h"
+#include "chorder_taphold.h"
+#include "chorder_typematic.h"
+#include "chorder_locale.h"
+#include "chorder_unicode.h"
+#include "chorder_keyscan.h"
+#include "chorder_trace.h"
+#include "chorder_keymap.h"
+#include "chorder_keymap_partition.h"
+#include "chorder_display.h"
+#include "hid_dev.h"
+#include "esp_crc.h"
+#include "mock_idf.h"
+#include "dict_build.h"
+#include "keymap_spec.h"
+#include "soc/gpio_reg.h"
+
+extern TFT_t dev;
+
+static unsigned checks = 0;
+static unsigned failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __FILE__, __LINE__)
+#define CHECK_EQ(actual, expected) \
+  check_eq((long long) (actual), (long long) (expected), #actual, __FILE__, __LINE__)
+
+static void check(bool ok, const char *what, const char *file, int line)
+{
+  checks++;
+  if (ok)
+    return;
+  failures++;
+  printf("%s:%d: FAILED: %s\n", file, line, what);
+}
+
+static void check_eq(long long actual, long long expected, const char *what, const char *file, int line)
+{
+  checks++;
+  if (actual == expected)
+    return;
+  failures++;
+  printf("%s:%d: FAILED: %s is %lld, expected %lld\n", file, line, what, actual, expected);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Handlers
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+// Keyboard reports sent since the last reset:
+#define RECORDED_MAX 4096
+static mock_hid_report_t recorded[RECORDED_MAX];
+static size_t recorded_count = 0;
+
+static void record(const mock_hid_report_t *report)
+{
+  if (recorded_count < RECORDED_MAX)
+    recorded[recorded_count++] = *report;
+}
+
+static void start_recording(void)
+{
+  recorded_count = 0;
+  mock_hid_report_hook = record;
+}
+
+static void stop_recording(void)
+{
+  mock_hid_report_hook = NULL;
+}
+
+// The chord typing symbol on layer, or 0 if there's none:
+static uint8_t chord_for(symbol_t symbol, uint8_t layer)
+{
+  for (uint8_t keyState = 1; keyState < KEYMAP_CHORDS; keyState++) {
+    if (keymap[keyState][layer] == symbol)
+      return keyState;
+  }
+  return 0;
+}
+
+static void test_keymap(void)
+{
+  for (uint8_t layer = 0; layer < KEYMAP_LAYERS; layer++) {
+    for (uint8_t keyState = 0; keyState < KEYMAP_CHORDS; keyState++)
+      CHECK(keymap[keyState][layer] < DIV_Last);
+  }
+  CHECK(0 != chord_for(HID_KEY_A, KEYMAP_ALPHA));
+  CHECK(0 != chord_for('a', KEYMAP_NOTE_UNSHIFTED));
+}
+
+static void test_keymap_partition(void)
+{
+  // chorder_keymap.h is regenerated whenever the symbols change:
+  CHECK_EQ(KEYMAP_SYMBOLS_FINGERPRINT, keymap_symbols_fingerprint());
+
+  static struct __attribute__((packed)) {
+    keymap_blob_header_t header;
+    symbol_t symbols[KEYMAP_CHORDS][KEYMAP_LAYERS];
+  } blob;
+  memcpy(blob.symbols, keymap_builtin, sizeof(blob.symbols));
+  blob.header = (keymap_blob_header_t) {
+    .magic = KEYMAP_BLOB_MAGIC,
+    .version = KEYMAP_BLOB_VERSION,
+    .chords = KEYMAP_CHORDS,
+    .layers = KEYMAP_LAYERS,
+    .crc32 = esp_crc32_le(0, (const uint8_t *) blob.symbols, sizeof(blob.symbols)),
+    .fingerprint = KEYMAP_SYMBOLS_FINGERPRINT,
+  };
+  esp_partition_t partition = {
+    .type = ESP_PARTITION_TYPE_DATA,
+    .subtype = KEYMAP_PARTITION_SUBTYPE,
+    .size = sizeof(blob),
+  };
+  mock_partition = &partition;
+  mock_partition_data = (const uint8_t *) &blob;
+
+  // A blob from before symbols were renumbered passes its CRC, but is refused:
+  blob.header.fingerprint ^= 1;
+  keymap_partition_load();
+  CHECK(keymap_builtin == keymap);
+  blob.header.fingerprint ^= 1;
+  keymap_partition_load();
+  CHECK(keymap_builtin != keymap);
+
+  keymap = keymap_builtin;
+  mock_partition = NULL;
+  mock_partition_data = NULL;
+}
+
+static void test_ble_keyboard(void)
+{
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  start_recording();
+  handle_keystate_update_as_ble_keyboard(chord_for(HID_KEY_A, KEYMAP_ALPHA));
+  stop_recording();
+
+  CHECK_EQ(recorded_count, 2);
+  CHECK_EQ(recorded[0].type, MOCK_HID_KEYBOARD);
+  CHECK_EQ(recorded[0].data[0], 0x00);
+  CHECK_EQ(recorded[0].data[2], HID_KEY_A);
+  static const uint8_t released[8] = { 0 };
+  CHECK(0 == memcmp(recorded[1].data, released, sizeof(released)));
+}
+
+// Recorded reports with key down, in any of their six slots:
+static size_t presses_of(uint8_t key)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < recorded_count; i++) {
+    if (MOCK_HID_KEYBOARD == recorded[i].type && NULL != memchr(recorded[i].data + 2, key, 6))
+      count++;
+  }
+  return count;
+}
+
+static void test_actions(void)
+{
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  uint8_t a = chord_for(HID_KEY_A, KEYMAP_ALPHA);
+
+  // A one-shot modifier applies to the next key only:
+  start_recording();
+  CHECK(! actions_execute(&keyboard_layers, MOD_LCTRL));
+  CHECK_EQ(recorded_count, 0);
+  handle_keystate_update_as_ble_keyboard(a);
+  handle_keystate_update_as_ble_keyboard(a);
+  stop_recording();
+  CHECK_EQ(recorded_count, 4);
+  CHECK_EQ(recorded[0].data[0], 0x01);
+  CHECK_EQ(recorded[0].data[2], HID_KEY_A);
+  CHECK_EQ(recorded[2].data[0], 0x00);
+  CHECK_EQ(recorded[2].data[2], HID_KEY_A);
+
+  // Text, then key reports:
+  start_recording();
+  CHECK(actions_execute(&keyboard_layers, MACRO_parens));
+  stop_recording();
+  CHECK_EQ(presses_of(HID_KEY_9), 1);
+  CHECK_EQ(presses_of(HID_KEY_0), 1);
+  CHECK(recorded_count >= 2);
+  CHECK_EQ(recorded[recorded_count - 2].data[2], HID_KEY_LEFT_ARROW);
+
+  // Media keys press and release their consumer usage:
+  start_recording();
+  CHECK(actions_execute(&keyboard_layers, MEDIA_volup));
+  stop_recording();
+  CHECK_EQ(recorded_count, 2);
+  CHECK_EQ(recorded[0].type, MOCK_HID_CONSUMER);
+  CHECK_EQ(recorded[0].data[0], HID_CONSUMER_VOLUME_UP);
+  CHECK_EQ(recorded[1].data[0], 0);
+
+  // Symbols without an action send nothing:
+  start_recording();
+  CHECK(! actions_execute(&keyboard_layers, NONBLE_NOKEY));
+  stop_recording();
+  CHECK_EQ(recorded_count, 0);
+}
+
+static void test_speculation(void)
+{
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  uint8_t w = chord_for(HID_KEY_W, KEYMAP_ALPHA);
+
+  // A plain key goes out ahead, and isn't typed again once committed:
+  start_recording();
+  CHECK(speculate_keystate(w));
+  CHECK(settle_speculation(w));
+  stop_recording();
+  CHECK_EQ(recorded_count, 2);
+  CHECK_EQ(recorded[0].data[2], HID_KEY_W);
+
+  // Nor are keys a backspace can't take back:
+  static const keymap_t unsafe[] = { HID_KEY_RETURN, HID_KEY_TAB, HID_KEY_ESCAPE, HID_KEY_DELETE };
+  start_recording();
+  for (size_t i = 0; i < sizeof(unsafe) / sizeof(unsafe[0]); i++) {
+    uint8_t keyState = chord_for(unsafe[i], KEYMAP_ALPHA);
+    CHECK(0 != keyState);
+    CHECK(! speculate_keystate(keyState));
+  }
+  // Or keys that'd go out with a one-shot or held Ctrl, Alt or GUI:
+  modKeys = 0x01;
+  CHECK(! speculate_keystate(w));
+  modKeys = 0x00;
+  heldModKeys = 0x04;
+  CHECK(! speculate_keystate(w));
+  heldModKeys = 0x00;
+  stop_recording();
+  CHECK_EQ(recorded_count, 0);
+
+  // Shift's fine:
+  modKeys = 0x02;
+  start_recording();
+  CHECK(speculate_keystate(w));
+  CHECK(settle_speculation(w));
+  stop_recording();
+  CHECK_EQ(recorded_count, 2);
+  CHECK_EQ(recorded[0].data[0], 0x02);
+  CHECK_EQ(modKeys, 0x00);
+}
+
+static void test_speculated_dict_stroke(void)
+{
+  uint8_t t = chord_for(HID_KEY_T, KEYMAP_ALPHA), h = chord_for(HID_KEY_H, KEYMAP_ALPHA);
+  const dict_entry_t entries[] = {
+    { .strokes = { t, h }, .nstrokes = 2, .text_len = 3, .text = "the" },
+  };
+  size_t size;
+  uint8_t *blob = dict_build(entries, 1, &size);
+  CHECK(dict_attach(&dictionary, blob, size));
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  dict_forget(&dictionary);
+
+  // T is typed as itself; H, sent ahead, still completes the outline, which
+  // takes back both:
+  uint32_t translations = dictionary.stats.translations;
+  start_recording();
+  handle_keystate_update_as_ble_keyboard(t);
+  CHECK(speculate_keystate(h));
+  CHECK_EQ(presses_of(HID_KEY_H), 1);
+  CHECK(settle_speculation(h));
+  stop_recording();
+  CHECK_EQ(dictionary.stats.translations, translations + 1);
+  CHECK_EQ(presses_of(HID_KEY_DELETE), 2);
+  CHECK_EQ(presses_of(HID_KEY_E), 1);
+
+  dict_forget(&dictionary);
+  dictionary.header = NULL;
+  free(blob);
+}
+
+static void record_and_cancel(const mock_hid_report_t *report)
+{
+  record(report);
+  snippet_cancel();
+}
+
+static void test_dict_build(void)
+{
+  uint8_t t = chord_for(HID_KEY_T, KEYMAP_ALPHA), h = chord_for(HID_KEY_H, KEYMAP_ALPHA);
+  const dict_entry_t entries[] = {
+    { .strokes = { t, h }, .nstrokes = 2, .text_len = 3, .text = "the" },
+    { .strokes = { t }, .nstrokes = 1, .text_len = 2, .text = "it" },
+    { .strokes = { t, h }, .nstrokes = 2, .text_len = 4, .text = "this" },
+  };
+  size_t size, deduped_size;
+  uint8_t *blob = dict_build(entries, 3, &size);
+  uint8_t *deduped = dict_build(entries + 1, 2, &deduped_size);
+  dictionary_t d = { 0 };
+  CHECK(dict_attach(&d, blob, size));
+
+  // The later definition wins, and the earlier one takes up no room:
+  CHECK_EQ(d.header->entries, 2);
+  CHECK_EQ(size, deduped_size);
+  const char *text;
+  uint8_t text_len;
+  CHECK(dict_lookup(&d, entries[0].strokes, 2, &text, &text_len));
+  CHECK_EQ(text_len, 4);
+  CHECK(0 == memcmp(text, "this", 4));
+  CHECK(dict_lookup(&d, entries[1].strokes, 1, &text, &text_len));
+  CHECK_EQ(text_len, 2);
+  // Nor does a prefix of an outline match it, or the other way around:
+  const uint8_t hh[] = { h, h }, tht[] = { t, h, t };
+  CHECK(! dict_lookup(&d, &h, 1, &text, &text_len));
+  CHECK(! dict_lookup(&d, hh, 2, &text, &text_len));
+  CHECK(! dict_lookup(&d, tht, 3, &text, &text_len));
+
+  free(deduped);
+  free(blob);
+}
+
+static void test_snippets(void)
+{
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  CHECK(! snippet_pending());
+
+  // Queued in order, and pending until the last has been typed out:
+  CHECK(snippet_send(0));
+  CHECK(snippet_send(1));
+  CHECK(snippet_pending());
+  uint32_t typed = snippet_stats.snippets;
+  start_recording();
+  CHECK(snippet_type_next());
+  stop_recording();
+  CHECK(snippet_pending());
+  CHECK_EQ(snippet_stats.snippets, typed + 1);
+  // "Kind regards,":
+  CHECK(recorded_count > 0);
+  CHECK_EQ(recorded[0].data[0], 0x02);
+  CHECK_EQ(recorded[0].data[2], HID_KEY_K);
+  CHECK(snippet_type_next());
+  CHECK(! snippet_type_next());
+  CHECK(! snippet_pending());
+
+  // A full queue drops the snippet instead of blocking:
+  uint32_t dropped = snippet_stats.dropped;
+  for (int i = 0; i < SNIPPET_QUEUE_SIZE; i++)
+    CHECK(snippet_send(0));
+  CHECK(! snippet_send(0));
+  CHECK_EQ(snippet_stats.dropped, dropped + 1);
+  while (snippet_type_next())
+    ;
+  CHECK(! snippet_pending());
+  // Unbound ones aren't queued at all:
+  CHECK(! snippet_send(SNIPPETS - 1));
+  CHECK(! snippet_pending());
+
+  // Cancelling drops those queued so far, leaving no key down, but not those
+  // queued after:
+  uint32_t cancelled = snippet_stats.cancelled;
+  CHECK(snippet_send(1));
+  CHECK(snippet_send(1));
+  snippet_cancel();
+  CHECK(snippet_send(0));
+  start_recording();
+  CHECK(snippet_type_next());
+  CHECK(snippet_type_next());
+  CHECK_EQ(recorded_count, 0);
+  CHECK(snippet_type_next());
+  stop_recording();
+  CHECK(! snippet_pending());
+  CHECK_EQ(snippet_stats.cancelled, cancelled + 2);
+  CHECK_EQ(presses_of(HID_KEY_K), 1);
+  CHECK(recorded_count > 0);
+  CHECK_EQ(recorded[recorded_count - 1].data[2], 0);
+
+  // Or partway through: what's packed already goes out, then a release:
+  CHECK(snippet_send(1));
+  recorded_count = 0;
+  mock_hid_report_hook = record_and_cancel;
+  CHECK(snippet_type_next());
+  stop_recording();
+  CHECK(! snippet_pending());
+  CHECK_EQ(snippet_stats.cancelled, cancelled + 3);
+  CHECK(recorded_count <= 3);
+  CHECK_EQ(recorded[recorded_count - 1].data[2], 0);
+
+  // Both are bound:
+  CHECK(0 != chord_for(SNIPPET_0, KEYMAP_FUNCTION));
+  CHECK(0 != chord_for(SNIPPET_1, KEYMAP_FUNCTION));
+}
+
+static symbol_t symbols[16];
+static size_t symbol_count;
+
+static void collect_symbol(symbol_t symbol)
+{
+  if (symbol_count < sizeof(symbols) / sizeof(symbols[0]))
+    symbols[symbol_count++] = symbol;
+}
+
+static void test_note_taking(void)
+{
+  switch_to_opmode(OPMODE_NOTETAKING);
+  symbol_count = 0;
+  handle_keystate_update_internally(chord_for('a', KEYMAP_NOTE_UNSHIFTED), collect_symbol);
+  CHECK_EQ(symbol_count, 1);
+  CHECK_EQ(symbols[0], 'a');
+}
+
+static void test_ble_mouse(void)
+{
+  switch_to_opmode(OPMODE_BLE_MOUSE);
+  uint32_t before = mock_hid_report_count;
+  for (uint8_t keyState = 1; keyState < KEYMAP_CHORDS; keyState++)
+    handle_keystate_update_as_ble_mouse(keyState);
+  CHECK(mock_hid_report_count > before);
+  switch_to_opmode(OPMODE_NOTETAKING);
+}
+
+static void test_urlencode(void)
+{
+  char dest[32];
+  CHECK(urlencode_into(dest, sizeof(dest), "a b&c~"));
+  CHECK(0 == strcmp(dest, "a%20b%26c~"));
+  CHECK(!urlencode_into(dest, 8, "far too long for it"));
+  CHECK(urlencode_into(dest, sizeof(dest), "\xc3\xa9"));
+  CHECK(0 == strcmp(dest, "%c3%a9"));
+}
+
+static void test_render_message(void)
+{
+  static FontxFile fx16[2];
+  lcdInit(&dev, CONFIG_WIDTH, CONFIG_HEIGHT, CONFIG_OFFSETX, CONFIG_OFFSETY);
+  InitFontx(fx16, CHORDER_FONT_DIR "/ILGH16XB.FNT", "");
+  unsigned char message[] = "Some note";
+  uint32_t before = mock_spi_transaction_count;
+  render_message(fx16, WHITE, 0, 20, DIR_W_TO_E, message);
+  CHECK(mock_spi_transaction_count > before);
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Scanning
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+// The register snapshot reads each key as the driver would, pin by pin:
+static void test_scan_snapshot(void)
+{
+  static const gpio_num_t pins[DEBOUNCE_KEYS] = {
+    [PINKY_BIT] = PINKY_PIN, [RING_BIT] = RING_PIN, [MIDDLE_BIT] = MIDDLE_PIN,
+    [INDEX_BIT] = INDEX_PIN, [N_THUMB_BIT] = N_THUMB_PIN, [C_THUMB_BIT] = C_THUMB_PIN,
+    [F_THUMB_BIT] = F_THUMB_PIN,
+  };
+  for (uint32_t i = 0; i < 1000; i++) {
+    mock_gpio_in_regs[0] = i * 2654435761U;
+    mock_gpio_in_regs[1] = ~i * 40503U;
+    uint8_t per_pin = 0;
+    for (int key = 0; key < DEBOUNCE_KEYS; key++)
+      per_pin |= !gpio_get_level(pins[key]) << key;
+    CHECK_EQ(keystate_from_gpio_in(REG_READ(GPIO_IN_REG), REG_READ(GPIO_IN1_REG)), per_pin);
+  }
+  mock_gpio_in_regs[0] = mock_gpio_in_regs[1] = 0xffffffff;
+}
+
+typedef struct {
+  int64_t at;
+  uint8_t keybit;
+  bool down;
+} edge_t;
+
+typedef struct {
+  key_event_t event;
+  int64_t delivered_at;                    // when the decoder got it
+} delivery_t;
+
+/* Replays edges through the interrupt-driven scanner, in 10 us steps: the
+ * interrupt handler timestamps each edge as it happens, and wakes the scanner
+ * wake_us later (once for any edges in between), which then reads the pins as
+ * they are by then. The scanner also wakes once a release has settled. Key
+ * events are handed on through the ring, as to the decoder.
+ */
+static size_t replay_edges(const edge_t *edges, size_t count, int32_t window_us, int64_t wake_us,
+    int64_t until, delivery_t *deliveries, size_t max)
+{
+  int32_t windows[DEBOUNCE_KEYS];
+  for (int key = 0; key < DEBOUNCE_KEYS; key++)
+    windows[key] = window_us;
+  debouncer_t db;
+  debounce_init(&db, windows);
+  static key_event_ring_t ring;
+  memset(&ring, 0, sizeof(ring));
+
+  uint8_t pins = 0, stable = 0;
+  int64_t edge_times[DEBOUNCE_KEYS] = { 0 };
+  int64_t wake_at = -1;
+  size_t next = 0, delivered = 0;
+  for (int64_t now = 0; now <= until; now += 10) {
+    for (; next < count && edges[next].at <= now; next++) {
+      uint8_t bit = 1 << edges[next].keybit;
+      pins = edges[next].down ? pins | bit : pins & ~bit;
+      edge_times[edges[next].keybit] = edges[next].at;
+      if (-1 == wake_at)
+        wake_at = edges[next].at + wake_us;
+    }
+    int64_t settles_at = debounce_next_deadline(&db);
+    if ((-1 == wake_at || now < wake_at) && (-1 == settles_at || now < settles_at))
+      continue;
+    wake_at = -1;
+    keyscan_step(&db, &stable, pins, edge_times, now, &ring);
+    key_event_t event;
+    while (delivered < max && key_event_ring_pop(&ring, &event)) {
+      deliveries[delivered].event = event;
+      deliveries[delivered++].delivered_at = now;
+    }
+  }
+  return delivered;
+}
+
+static void test_scan_bouncy_key(void)
+{
+  // I bounces going down, and again coming up:
+  static const edge_t edges[] = {
+    {  1000, INDEX_BIT, true }, {  1040, INDEX_BIT, false }, {  1090, INDEX_BIT, true },
+    { 40000, INDEX_BIT, false }, { 40060, INDEX_BIT, true }, { 40150, INDEX_BIT, false },
+  };
+  delivery_t d[8];
+  size_t n = replay_edges(edges, sizeof(edges) / sizeof(edges[0]), 5000, 30, 100000, d, 8);
+
+  CHECK_EQ(n, 2);
+  // The press is taken on its first edge, stamped with it, and seen as soon
+  // as the scanner's woken:
+  CHECK_EQ(d[0].event.keyState, 1 << INDEX_BIT);
+  CHECK_EQ(d[0].event.timestamp, 1000);
+  CHECK(d[0].delivered_at - 1000 <= 30 + 10);
+  // The release only once the last bounce has settled:
+  CHECK_EQ(d[1].event.keyState, 0);
+  CHECK_EQ(d[1].event.timestamp, 40150);
+  CHECK(d[1].delivered_at >= 40150 + 5000);
+  CHECK(d[1].delivered_at <= 40150 + 5000 + 10);
+}
+
+static void test_scan_glitch_between_reads(void)
+{
+  // A glitch that's over before the scanner gets to read the pins still
+  // restarts the release's debounce window:
+  static const edge_t edges[] = {
+    {  1000, PINKY_BIT, true },
+    { 20000, PINKY_BIT, false },
+    { 22000, PINKY_BIT, true }, { 22005, PINKY_BIT, false },
+  };
+  delivery_t d[8];
+  size_t n = replay_edges(edges, sizeof(edges) / sizeof(edges[0]), 5000, 30, 60000, d, 8);
+
+  CHECK_EQ(n, 2);
+  CHECK_EQ(d[1].event.keyState, 0);
+  CHECK_EQ(d[1].event.timestamp, 22005);
+  CHECK(d[1].delivered_at >= 22005 + 5000);
+}
+
+static void test_scan_chord(void)
+{
+  static const edge_t edges[] = {
+    {  1000, INDEX_BIT, true },
+    {  3000, MIDDLE_BIT, true },
+    { 50000, INDEX_BIT, false },
+    { 50500, MIDDLE_BIT, false },
+  };
+  delivery_t d[8];
+  size_t n = replay_edges(edges, sizeof(edges) / sizeof(edges[0]), 5000, 30, 100000, d, 8);
+
+  static const uint8_t states[] = { 0x08, 0x0C, 0x04, 0x00 };
+  static const int64_t stamps[] = { 1000, 3000, 50000, 50500 };
+  CHECK_EQ(n, 4);
+  for (size_t i = 0; i < n && i < 4; i++) {
+    CHECK_EQ(d[i].event.keyState, states[i]);
+    CHECK_EQ(d[i].event.timestamp, stamps[i]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Traces
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+static void test_trace_lines(void)
+{
+  // Formatted and parsed back, timestamps past 32 bits and all:
+  static const key_event_t samples[] = {
+    { .timestamp = 0, .keyState = 0x00 },
+    { .timestamp = 1234, .keyState = 0x7f },
+    { .timestamp = 5000000000123LL, .keyState = 0x48 },
+  };
+  for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+    char line[TRACE_LINE_MAX];
+    int len = trace_format_line(line, sizeof(line), &samples[i]);
+    CHECK(len > 0 && len < TRACE_LINE_MAX);
+    CHECK_EQ(len, strlen(line));
+    CHECK_EQ(line[len - 1], '\n');
+    key_event_t parsed = { 0 };
+    CHECK(trace_parse_line(line, &parsed));
+    CHECK_EQ(parsed.timestamp, samples[i].timestamp);
+    CHECK_EQ(parsed.keyState, samples[i].keyState);
+  }
+
+  // Picked out of a console log:
+  key_event_t parsed = { 0 };
+  CHECK(trace_parse_line("I (5123) trace_writer_task: KT 1000 0c", &parsed));
+  CHECK_EQ(parsed.timestamp, 1000);
+  CHECK_EQ(parsed.keyState, 0x0c);
+  // ... and nothing else:
+  static const char *const junk[] = { "", "I (5123) main: hello", "KT ", "KT 1000", "KT x 0c", "KT 1000 80" };
+  for (size_t i = 0; i < sizeof(junk) / sizeof(junk[0]); i++)
+    CHECK(! trace_parse_line(junk[i], &parsed));
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Debouncing
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+/* Raw keyStates as CONFIG_CHORDER_TRACE records them: I goes down bouncing, M
+ * goes down while I's settling, then I comes up bouncing, and M after it: */
+static const char *const bouncy_trace[] = {
+  "KT 10000 08", "KT 10300 00", "KT 10450 08", "KT 10900 00", "KT 11100 08",
+  "KT 12000 0c",
+  "KT 60000 04", "KT 60200 0c", "KT 60350 04",
+  "KT 80000 00", "KT 80150 04", "KT 80250 00",
+};
+#define BOUNCY_SAMPLES (sizeof(bouncy_trace) / sizeof(bouncy_trace[0]))
+
+// The debounced keyStates it should come out as, and when the physical
+// change behind each happened (the first edge of a press, the last of a
+// release):
+static const uint8_t bouncy_states[] = { 0x08, 0x0c, 0x04, 0x00 };
+static const int64_t bouncy_edges[] = { 10000, 12000, 60350, 80250 };
+#define BOUNCY_WINDOW_US 5000
+
+typedef struct {
+  uint8_t keyState;
+  int64_t at;
+} change_t;
+
+/* Runs the trace through a debouncer, reading the raw keyState every poll_us
+ * (or on every sample, for 0) and again whenever a release is due to settle;
+ * returns the debounced changes and when they were seen:
+ */
+static size_t debounce_trace(int64_t poll_us, change_t *changes, size_t max)
+{
+  key_event_t samples[BOUNCY_SAMPLES];
+  for (size_t i = 0; i < BOUNCY_SAMPLES; i++)
+    CHECK(trace_parse_line(bouncy_trace[i], &samples[i]));
+
+  int32_t windows[DEBOUNCE_KEYS];
+  for (int key = 0; key < DEBOUNCE_KEYS; key++)
+    windows[key] = BOUNCY_WINDOW_US;
+  debouncer_t db;
+  debounce_init(&db, windows);
+
+  uint8_t raw = 0, stable = 0;
+  size_t next = 0, count = 0;
+  int64_t next_poll = 0;
+  int64_t end = samples[BOUNCY_SAMPLES - 1].timestamp + 2 * BOUNCY_WINDOW_US;
+  while (true) {
+    // The next reading: a sample (or poll), or a release settling:
+    int64_t now = 0 == poll_us ? (next < BOUNCY_SAMPLES ? samples[next].timestamp : end) : next_poll;
+    int64_t settles_at = debounce_next_deadline(&db);
+    if (-1 != settles_at && settles_at < now)
+      now = settles_at;
+    if (now > end)
+      break;
+    for (; next < BOUNCY_SAMPLES && samples[next].timestamp <= now; next++)
+      raw = samples[next].keyState;
+    if (now == next_poll)
+      next_poll += 0 == poll_us ? 0 : poll_us;
+    uint8_t debounced = debounce_update(&db, raw, NULL, now);
+    if (debounced != stable && count < max) {
+      changes[count].keyState = debounced;
+      changes[count++].at = now;
+    }
+    stable = debounced;
+    if (0 == poll_us && next >= BOUNCY_SAMPLES && -1 == debounce_next_deadline(&db))
+      break;
+  }
+  return count;
+}
+
+static void test_debounce_bouncy_trace(void)
+{
+  static const int64_t polls[] = { 0, 1000 };
+  for (size_t p = 0; p < sizeof(polls) / sizeof(polls[0]); p++) {
+    change_t changes[16];
+    size_t n = debounce_trace(polls[p], changes, 16);
+    // Every bounce is ridden out; nothing but the four real changes:
+    CHECK_EQ(n, 4);
+
+    int64_t press_worst = 0, release_worst = 0;
+    for (size_t i = 0; i < n && i < 4; i++) {
+      CHECK_EQ(changes[i].keyState, bouncy_states[i]);
+      int64_t latency = changes[i].at - bouncy_edges[i];
+      CHECK(latency >= 0);
+      bool press = 0 != (bouncy_states[i] & ~(i ? bouncy_states[i - 1] : 0));
+      if (press) {
+        // Taken on the first reading with the key down:
+        CHECK(latency <= polls[p]);
+        if (latency > press_worst)
+          press_worst = latency;
+      } else {
+        // Once the window's passed since the last bounce seen:
+        CHECK(latency <= BOUNCY_WINDOW_US + polls[p]);
+        if (latency > release_worst)
+          release_worst = latency;
+      }
+    }
+    if (0 == polls[p]) {
+      CHECK_EQ(press_worst, 0);
+      CHECK_EQ(release_worst, BOUNCY_WINDOW_US);
+    }
+    printf("debounce, %s: press detected within %lld us, release within %lld us\n",
+        polls[p] ? "polled every 1 ms" : "read on every edge",
+        (long long) press_worst, (long long) release_worst);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Chords
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+#define KEY_P (1 << 0)
+#define KEY_R (1 << 1)
+#define KEY_M (1 << 2)
+#define KEY_I (1 << 3)
+
+static void test_chord_first_release(void)
+{
+  chord_machine_t cm;
+  chord_machine_init(&cm, CHORD_COMMIT_FIRST_RELEASE, 0);
+
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I, 0), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I | KEY_M, 5000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M, 60000), KEY_I | KEY_M);
+  // Without rollover, keys held over are part of the next chord:
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_R | KEY_P, 70000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_P, 80000), KEY_M | KEY_R | KEY_P);
+  CHECK_EQ(chord_machine_feed(&cm, 0, 90000), 0);
+}
+
+static void test_chord_rollover_stale(void)
+{
+  chord_machine_t cm;
+  chord_machine_init(&cm, CHORD_COMMIT_ROLLOVER, 30000);
+
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I | KEY_M, 0), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M, 50000), KEY_I | KEY_M);
+  // M's held over while RP is pressed, and R let go of 10 ms on; M's still
+  // in the rollover window, so isn't part of the chord:
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_R | KEY_P, 60000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_P, 70000), KEY_R | KEY_P);
+
+  // Letting go of the stale key within the window commits nothing:
+  chord_machine_init(&cm, CHORD_COMMIT_ROLLOVER, 30000);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I | KEY_M, 0), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M, 50000), KEY_I | KEY_M);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_R | KEY_P, 60000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_R | KEY_P, 70000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_P, 80000), KEY_R | KEY_P);
+
+  // Held past the window, it's part of the next chord after all:
+  chord_machine_init(&cm, CHORD_COMMIT_ROLLOVER, 30000);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I | KEY_M, 0), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M, 50000), KEY_I | KEY_M);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_R | KEY_P, 60000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_P, 95000), KEY_M | KEY_R | KEY_P);
+}
+
+static void test_chord_speculation(void)
+{
+  chord_machine_t cm;
+  chord_machine_init(&cm, CHORD_COMMIT_ROLLOVER, 30000);
+  chord_machine_set_speculation(&cm, 20000);
+
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I | KEY_M, 0), 0);
+  CHECK_EQ(chord_machine_speculation_deadline(&cm), 20000);
+  CHECK_EQ(chord_machine_speculate(&cm, 10000), 0);
+  CHECK_EQ(chord_machine_speculate(&cm, 20000), KEY_I | KEY_M);
+  // Only once per keyState:
+  CHECK_EQ(chord_machine_speculate(&cm, 25000), 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M, 50000), KEY_I | KEY_M);
+
+  // Stale keys still in the window aren't speculated on either:
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_R | KEY_P, 60000), 0);
+  CHECK_EQ(chord_machine_speculate(&cm, 80000), KEY_R | KEY_P);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_M | KEY_P, 85000), KEY_R | KEY_P);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tap-hold
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+#define KEY_C (1 << 5)
+#define KEY_F (1 << 6)
+#define HOLD_US 200000
+
+static void test_taphold_tap(void)
+{
+  taphold_t th;
+  chord_machine_t cm;
+  uint8_t released;
+  taphold_init(&th, HOLD_US);
+  chord_machine_init(&cm, CHORD_COMMIT_FIRST_RELEASE, 0);
+
+  // F let go of before the hold time is a tap, committed as usual:
+  CHECK_EQ(taphold_feed(&th, KEY_F, 0, &released), KEY_F);
+  CHECK_EQ(released, 0);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_F, 0), 0);
+  CHECK_EQ(taphold_deadline(&th), HOLD_US);
+  CHECK_EQ(taphold_resolve(&th, HOLD_US - 1), 0);
+  CHECK_EQ(taphold_feed(&th, 0, HOLD_US - 1, &released), 0);
+  CHECK_EQ(released, 0);
+  CHECK_EQ(chord_machine_feed(&cm, 0, HOLD_US - 1), KEY_F);
+  CHECK_EQ(taphold_deadline(&th), -1);
+  CHECK_EQ(taphold_resolve(&th, 2 * HOLD_US), 0);
+
+  // Nor is one that isn't held still; the hold time starts over:
+  CHECK_EQ(taphold_feed(&th, KEY_F | KEY_I, 0, &released), KEY_F | KEY_I);
+  CHECK_EQ(taphold_deadline(&th), -1);
+  CHECK_EQ(taphold_feed(&th, KEY_F, 100000, &released), KEY_F);
+  CHECK_EQ(taphold_deadline(&th), 100000 + HOLD_US);
+}
+
+static void test_taphold_hold(void)
+{
+  taphold_t th;
+  chord_machine_t cm;
+  uint8_t released;
+  taphold_init(&th, HOLD_US);
+  chord_machine_init(&cm, CHORD_COMMIT_FIRST_RELEASE, 0);
+
+  // F held still for the hold time is held, and isn't committed:
+  CHECK_EQ(taphold_feed(&th, KEY_F, 0, &released), KEY_F);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_F, 0), 0);
+  CHECK_EQ(taphold_resolve(&th, HOLD_US), KEY_F);
+  chord_machine_restart(&cm, 0, HOLD_US);
+  CHECK_EQ(taphold_deadline(&th), -1);
+
+  // Chords typed meanwhile leave it out:
+  CHECK_EQ(taphold_feed(&th, KEY_F | KEY_I, 250000, &released), KEY_I);
+  CHECK_EQ(chord_machine_feed(&cm, KEY_I, 250000), 0);
+  CHECK_EQ(taphold_feed(&th, KEY_F, 300000, &released), 0);
+  CHECK_EQ(released, 0);
+  CHECK_EQ(chord_machine_feed(&cm, 0, 300000), KEY_I);
+  // It's not up for holding again while it's held:
+  CHECK_EQ(taphold_deadline(&th), -1);
+
+  // Letting go of it is reported, and commits nothing:
+  CHECK_EQ(taphold_feed(&th, 0, 350000, &released), 0);
+  CHECK_EQ(released, KEY_F);
+  CHECK_EQ(chord_machine_feed(&cm, 0, 350000), 0);
+
+  // A held chord lets go as soon as any of its keys does, but the rest stay
+  // out of chords until they're up:
+  CHECK_EQ(taphold_feed(&th, KEY_F | KEY_C, 400000, &released), KEY_F | KEY_C);
+  CHECK_EQ(taphold_resolve(&th, 400000 + HOLD_US), KEY_F | KEY_C);
+  CHECK_EQ(taphold_feed(&th, KEY_F, 700000, &released), 0);
+  CHECK_EQ(released, KEY_F | KEY_C);
+  CHECK_EQ(taphold_feed(&th, KEY_F | KEY_I, 750000, &released), KEY_I);
+  CHECK_EQ(released, 0);
+  CHECK_EQ(taphold_feed(&th, KEY_I, 800000, &released), KEY_I);
+  CHECK_EQ(taphold_feed(&th, KEY_I | KEY_F, 850000, &released), KEY_I | KEY_F);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Typematic repeat
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+#define REPEAT_DELAY_US 300000
+#define REPEAT_INTERVAL_US 50000
+
+static void test_typematic_timing(void)
+{
+  typematic_t tm;
+  typematic_init(&tm, REPEAT_DELAY_US, REPEAT_INTERVAL_US);
+  CHECK_EQ(typematic_deadline(&tm), -1);
+
+  // Typed first once held still for the delay, then every interval:
+  const int64_t since = 1000;
+  CHECK_EQ(typematic_hold(&tm, KEY_I, since), 0);
+  CHECK_EQ(typematic_deadline(&tm), since + REPEAT_DELAY_US);
+  CHECK(! typematic_due(&tm, since + REPEAT_DELAY_US - 1));
+  CHECK(typematic_due(&tm, since + REPEAT_DELAY_US));
+  CHECK_EQ(tm.typed, 1);
+  CHECK_EQ(typematic_deadline(&tm), since + REPEAT_DELAY_US + REPEAT_INTERVAL_US);
+  CHECK(! typematic_due(&tm, since + REPEAT_DELAY_US + REPEAT_INTERVAL_US - 1));
+  CHECK(typematic_due(&tm, since + REPEAT_DELAY_US + REPEAT_INTERVAL_US));
+  CHECK_EQ(tm.typed, 2);
+
+  // A late wake-up doesn't push later repeats back:
+  CHECK(typematic_due(&tm, since + REPEAT_DELAY_US + 2 * REPEAT_INTERVAL_US + 20000));
+  CHECK_EQ(typematic_deadline(&tm), since + REPEAT_DELAY_US + 3 * REPEAT_INTERVAL_US);
+  // ... and ones missed altogether are skipped, not sent in a burst:
+  CHECK(typematic_due(&tm, since + REPEAT_DELAY_US + 6 * REPEAT_INTERVAL_US + 10000));
+  CHECK(! typematic_due(&tm, since + REPEAT_DELAY_US + 6 * REPEAT_INTERVAL_US + 20000));
+  CHECK_EQ(typematic_deadline(&tm), since + REPEAT_DELAY_US + 7 * REPEAT_INTERVAL_US);
+
+  // Following the same chord again changes nothing; letting go of it
+  // reports it typed, so its commit can be dropped:
+  CHECK_EQ(typematic_hold(&tm, KEY_I, since), 0);
+  CHECK_EQ(tm.typed, 7);
+  CHECK_EQ(typematic_hold(&tm, 0, 700000), KEY_I);
+  CHECK_EQ(typematic_deadline(&tm), -1);
+
+  // One let go of before the delay wasn't typed:
+  CHECK_EQ(typematic_hold(&tm, KEY_M, 800000), 0);
+  CHECK_EQ(typematic_hold(&tm, 0, 800000 + REPEAT_DELAY_US - 1), 0);
+
+  // Nor is one stopped repeated:
+  CHECK_EQ(typematic_hold(&tm, KEY_M, 2000000), 0);
+  CHECK(typematic_due(&tm, 2000000 + REPEAT_DELAY_US));
+  typematic_stop(&tm);
+  CHECK_EQ(typematic_deadline(&tm), -1);
+  CHECK(! typematic_due(&tm, 3000000));
+  CHECK_EQ(typematic_hold(&tm, 0, 3000000), KEY_M);
+}
+
+static void test_typematic_keys(void)
+{
+  // In BLE keyboard mode, keys that don't type characters repeat:
+  switch_to_opmode(OPMODE_BLE_KEYBOARD);
+  uint8_t del = chord_for(HID_KEY_DELETE, KEYMAP_ALPHA);
+  CHECK(typematic_applies(del));
+  CHECK(! typematic_applies(chord_for(HID_KEY_A, KEYMAP_ALPHA)));
+
+  start_recording();
+  CHECK(typematic_type(del, true));
+  CHECK(typematic_type(del, false));
+  CHECK(typematic_type(del, false));
+  stop_recording();
+  CHECK_EQ(presses_of(HID_KEY_DELETE), 3);
+
+  // In note-taking mode, only backspace does:
+  switch_to_opmode(OPMODE_NOTETAKING);
+  CHECK(typematic_applies(chord_for(NONBLE_BACKSPACE, KEYMAP_NOTE_UNSHIFTED)));
+  CHECK(! typematic_applies(chord_for('a', KEYMAP_NOTE_UNSHIFTED)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Report packing
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+/* Plays the part of the host's keyboard driver and layout: every key that's
+ * down in a report and wasn't in the one before is a press, in the order the
+ * report lists them, and types what the active locale has on it (after the
+ * dead key before it, if it was one).
+ */
+#define DECODED_MAX 8192
+static struct {
+  uint8_t keys[6];
+  uint8_t dead_mod, dead_key;
+  uint32_t codepoints[DECODED_MAX];
+  size_t len;
+} host_keyboard;
+
+static int32_t host_keyboard_char(uint8_t dead_mod, uint8_t dead_key, uint8_t mod, uint8_t key)
+{
+  for (int c = 0; c < 128; c++) {
+    const locale_stroke_t *stroke = &active_locale->ascii[c];
+    if (0 != stroke->key && stroke->key == key && stroke->mod == mod
+        && stroke->dead_key == dead_key && (0 == dead_key || stroke->dead_mod == dead_mod))
+      return c;
+  }
+  for (uint16_t i = 0; i < active_locale->extras_len; i++) {
+    const locale_extra_t *extra = &active_locale->extras[i];
+    const locale_stroke_t *stroke = &extra->stroke;
+    if (stroke->key == key && stroke->mod == mod
+        && stroke->dead_key == dead_key && (0 == dead_key || stroke->dead_mod == dead_mod))
+      return extra->codepoint;
+  }
+  return -1;
+}
+
+static void host_keyboard_feed(const mock_hid_report_t *report)
+{
+  if (MOCK_HID_KEYBOARD != report->type)
+    return;
+  uint8_t mod = report->data[0];
+  for (int i = 2; i < 8; i++) {
+    uint8_t key = report->data[i];
+    if (0 == key || NULL != memchr(host_keyboard.keys, key, sizeof(host_keyboard.keys)))
+      continue;
+    int32_t c = host_keyboard_char(host_keyboard.dead_mod, host_keyboard.dead_key, mod, key);
+    if (0 == host_keyboard.dead_key && -1 == c) {
+      host_keyboard.dead_mod = mod;
+      host_keyboard.dead_key = key;
+      continue;
+    }
+    host_keyboard.dead_key = 0;
+    if (host_keyboard.len < DECODED_MAX)
+      host_keyboard.codepoints[host_keyboard.len++] = c;
+  }
+  memcpy(host_keyboard.keys, &report->data[2], sizeof(host_keyboard.keys));
+}
+
+// Types text back as the host would, returning whether it's what was sent
+// (less characters the locale can't type, there being no input method):
+static bool typed_back_intact(const char *text)
+{
+  static uint32_t expected[DECODED_MAX];
+  size_t len = strlen(text), expected_len = 0;
+  for (const char *c = text; c < text + len; ) {
+    uint32_t codepoint = locale_utf8_next(&c, text + len - c);
+    if (NULL != locale_lookup(codepoint) && expected_len < DECODED_MAX)
+      expected[expected_len++] = codepoint;
+  }
+
+  memset(&host_keyboard, 0, sizeof(host_keyboard));
+  mock_hid_report_hook = host_keyboard_feed;
+  bool streamed = snippet_stream(text);
+  mock_hid_report_hook = NULL;
+  return streamed && host_keyboard.len == expected_len
+    && 0 == memcmp(host_keyboard.codepoints, expected, expected_len * sizeof(expected[0]));
+}
+
+// Every character each locale types, twice over, with runs of repeated keys
+// and modifier changes, packed six keys to a report where it can be:
+static void test_keyreport_round_trip(void)
+{
+  static char text[4 * DECODED_MAX];
+  for (uint8_t id = 0; id < LOCALES; id++) {
+    locale_select(id);
+    size_t len = 0;
+    for (int pass = 0; pass < 2; pass++) {
+      for (int c = 1; c < 128; c++)
+        text[len++] = c;
+      for (uint16_t i = 0; i < active_locale->extras_len; i++) {
+        uint16_t cp = active_locale->extras[i].codepoint;
+        if (cp < 0x800) {
+          text[len++] = 0xC0 | cp >> 6;
+        } else {
+          text[len++] = 0xE0 | cp >> 12;
+          text[len++] = 0x80 | ((cp >> 6) & 0x3F);
+        }
+        text[len++] = 0x80 | (cp & 0x3F);
+      }
+      len += sprintf(text + len, "aaa  bookkeeper, Mississippi!! %s", snippet_texts[1]);
+    }
+    text[len] = '\0';
+    bool intact = typed_back_intact(text);
+    if (!intact)
+      printf("Typed back differently in locale %s\n", active_locale->name);
+    CHECK(intact);
+  }
+  locale_select(LOCALE_US);
+
+  // Repeated keys and modifier changes split reports; six distinct keys
+  // with the same modifiers don't:
+  uint32_t before = mock_hid_report_count;
+  CHECK(typed_back_intact("abcdef"));
+  CHECK_EQ(mock_hid_report_count - before, 2);
+  before = mock_hid_report_count;
+  CHECK(typed_back_intact("aaA"));
+  CHECK_EQ(mock_hid_report_count - before, 6);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unicode input
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+/* Plays the part of the host's Unicode input method, going by the same
+ * conventions as chorder_unicode.c: takes the keyboard reports as they come,
+ * and hands back each code point once it's been entered.
+ */
+typedef struct {
+  uint8_t mod;
+  uint8_t key;                             // key down as of the last report
+  bool entering;
+  uint32_t value;
+  uint32_t high_surrogate;
+  int digits;
+} input_method_t;
+
+// The character a plain key types in the active locale, for hex entry:
+static int locale_char(uint8_t mod, uint8_t key)
+{
+  for (int c = 0; c < 128; c++) {
+    const locale_stroke_t *stroke = &active_locale->ascii[c];
+    if (stroke->key == key && stroke->mod == mod && 0 == stroke->dead_key)
+      return c;
+  }
+  return -1;
+}
+
+static int hex_value(int c)
+{
+  return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+// The code point entered with this report, or -1 for none yet:
+static int32_t input_method_feed(input_method_t *im, const unicode_report_t *report)
+{
+  bool pressed = 0 != report->key && report->key != im->key;
+  bool alt_up = (im->mod & 0x04) && !(report->mod & 0x04);
+  uint8_t mod = report->mod, key = report->key;
+  im->mod = report->mod;
+  im->key = report->key;
+  int32_t entered = -1;
+
+  switch (unicode_method) {
+    case UNICODE_LINUX:
+      if (pressed && 0x03 == mod && HID_KEY_U == key) {
+        im->entering = true;
+        im->value = 0;
+      } else if (pressed && im->entering) {
+        int c = locale_char(mod, key);
+        if (' ' == c) {
+          entered = im->value;
+          im->entering = false;
+        } else {
+          im->value = im->value << 4 | hex_value(c);
+        }
+      }
+      break;
+
+    case UNICODE_MACOS:
+      // As typed on the US layout, which Unicode Hex Input is:
+      if (pressed && (mod & 0x04)) {
+        int digit = HID_KEY_0 == key ? 0 : key >= HID_KEY_1 && key < HID_KEY_0 ? key - HID_KEY_1 + 1 : key - HID_KEY_A + 10;
+        im->value = im->value << 4 | digit;
+        if (4 == ++im->digits) {
+          if (im->value >= 0xD800 && im->value < 0xDC00) {
+            im->high_surrogate = im->value;
+          } else {
+            entered = 0 != im->high_surrogate
+              ? 0x10000 + ((im->high_surrogate - 0xD800) << 10) + (im->value - 0xDC00)
+              : im->value;
+            im->high_surrogate = 0;
+          }
+          im->value = 0;
+          im->digits = 0;
+        }
+      }
+      break;
+
+    case UNICODE_WINDOWS:
+      if (pressed && (mod & 0x04) && HID_KEY_ADD == key) {
+        im->entering = true;
+        im->value = 0;
+      } else if (pressed && im->entering) {
+        int digit = HID_KEYPAD_0 == key ? 0 : key >= HID_KEYPAD_1 && key <= HID_KEYPAD_9 ? key - HID_KEYPAD_1 + 1 : hex_value(locale_char(mod & ~0x04, key));
+        im->value = im->value << 4 | digit;
+      } else if (alt_up && im->entering) {
+        entered = im->value;
+        im->entering = false;
+      }
+      break;
+  }
+  return entered;
+}
+
+// Has code points across the BMP and beyond entered through each input
+// method, in each locale, and checks each comes out once, with every key up:
+static void test_unicode_round_trip(void)
+{
+  for (uint8_t method = UNICODE_LINUX; method < UNICODE_METHODS; method++) {
+    unicode_select(method);
+    for (uint8_t id = 0; id < LOCALES; id++) {
+      locale_select(id);
+      unsigned typable = 0, intact = 0;
+      for (uint32_t i = 0; i < 4000; i++) {
+        // Every hex digit turns up, and surrogate pairs every other time:
+        uint32_t codepoint = 0xA0 + (uint32_t) (i * 2654435761UL % (i & 1 ? 0x10FF60 : 0xFF60));
+        unicode_report_t sequence[UNICODE_MAX_REPORTS];
+        size_t count = unicode_reports(codepoint, sequence);
+        if (0 == count)
+          continue;
+        typable++;
+        input_method_t im = { 0 };
+        int32_t entered = -1, entries = 0;
+        for (size_t r = 0; r < count; r++) {
+          int32_t c = input_method_feed(&im, &sequence[r]);
+          if (-1 != c) {
+            entered = c;
+            entries++;
+          }
+        }
+        bool ok = 1 == entries && (uint32_t) entered == codepoint && 0 == im.key && 0 == im.mod;
+        if (!ok)
+          printf("U+%04X through input method %u, locale %s: entered as U+%04X, %d times\n",
+              (unsigned) codepoint, method, active_locale->name, (unsigned) entered, (int) entries);
+        intact += ok;
+      }
+      CHECK(typable > 0);
+      CHECK_EQ(intact, typable);
+    }
+  }
+  unicode_select(UNICODE_NONE);
+  locale_select(LOCALE_US);
+}
+
+// }}}
+
+int main(int argc, char **argv)
+{
+  mock_log_level = 1;
+  sec_conn = true;
+
+  test_keymap();
+  test_keymap_partition();
+  test_ble_keyboard();
+  test_actions();
+  test_speculation();
+  test_snippets();
+  test_speculated_dict_stroke();
+  test_dict_build();
+  test_note_taking();
+  test_ble_mouse();
+  test_urlencode();
+  test_render_message();
+  test_scan_snapshot();
+  test_scan_bouncy_key();
+  test_scan_glitch_between_reads();
+  test_scan_chord();
+  test_trace_lines();
+  test_debounce_bouncy_trace();
+  test_chord_first_release();
+  test_chord_rollover_stale();
+  test_chord_speculation();
+  test_taphold_tap();
+  test_taphold_hold();
+  test_typematic_timing();
+  test_typematic_keys();
+  test_keyreport_round_trip();
+  test_unicode_round_trip();
+
+  printf("%u checks, %u failed\n", checks, failures);
+  return 0 == failures ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_crc.h"
+#include "dict_build.h"
+
+#define NO_ENTRY UINT32_MAX
+
+// Enough buckets for entries to leave a quarter of them empty:
+static uint32_t buckets_for(size_t entries)
+{
+  return (uint32_t) (entries + (entries + 2) / 3 + 1);
+}
+
+static bool same_outline(const dict_entry_t *a, const dict_entry_t *b)
+{
+  return a->nstrokes == b->nstrokes && 0 == memcmp(a->strokes, b->strokes, a->nstrokes);
+}
+
+/* Indices of the entries that make it into the dictionary, in order, with
+ * later entries for an outline replacing earlier ones; a dictionary merged
+ * from several tends to have plenty of those. Returns how many there are.
+ */
+static size_t dedupe(const dict_entry_t *entries, size_t count, uint32_t *kept)
+{
+  uint32_t nslots = buckets_for(count);
+  uint32_t *slots = malloc(nslots * sizeof(uint32_t));
+  memset(slots, 0xFF, nslots * sizeof(uint32_t));
+  for (size_t i = 0; i < count; i++) {
+    uint32_t s = dict_home(dict_hash(entries[i].strokes, entries[i].nstrokes), nslots);
+    while (NO_ENTRY != slots[s] && !same_outline(&entries[slots[s]], &entries[i]))
+      s = s + 1 == nslots ? 0 : s + 1;
+    slots[s] = i;
+  }
+  // In the order the entries came in, for the records to be too:
+  size_t nkept = 0;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t s = dict_home(dict_hash(entries[i].strokes, entries[i].nstrokes), nslots);
+    while (!same_outline(&entries[slots[s]], &entries[i]))
+      s = s + 1 == nslots ? 0 : s + 1;
+    if (slots[s] == i)
+      kept[nkept++] = i;
+  }
+  free(slots);
+  return nkept;
+}
+
+uint8_t *dict_build(const dict_entry_t *entries, size_t count, size_t *size)
+{
+  uint32_t *kept = malloc((count + 1) * sizeof(uint32_t));
+  size_t nkept = dedupe(entries, count, kept);
+  if (nkept < count)
+    fprintf(stderr, "%zu definitions left out, for outlines defined again later\n", count - nkept);
+
+  uint32_t nbuckets = buckets_for(nkept);
+  size_t records_size = 0;
+  for (size_t k = 0; k < nkept; k++)
+    records_size += 1 + entries[kept[k]].nstrokes + entries[kept[k]].text_len;
+  if (records_size > DICT_RECORDS_MAX) {
+    fprintf(stderr, "%zu bytes of records is more than a dictionary can hold\n", records_size);
+    free(kept);
+    return NULL;
+  }
+
+  *size = sizeof(dict_blob_header_t) + nbuckets * sizeof(uint32_t) + records_size;
+  uint8_t *blob = calloc(1, *size);
+  if (NULL == blob) {
+    free(kept);
+    return NULL;
+  }
+  dict_blob_header_t *header = (dict_blob_header_t *) blob;
+  uint32_t *buckets = (uint32_t *) (header + 1);
+  uint8_t *records = (uint8_t *) (buckets + nbuckets);
+  memset(buckets, 0xFF, nbuckets * sizeof(uint32_t));
+
+  uint8_t max_strokes = 1;
+  size_t pos = 0;
+  for (size_t k = 0; k < nkept; k++) {
+    const dict_entry_t *entry = &entries[kept[k]];
+    uint32_t hash = dict_hash(entry->strokes, entry->nstrokes);
+    uint32_t bucket = dict_home(hash, nbuckets);
+    while (DICT_BUCKET_EMPTY != buckets[bucket])
+      bucket = bucket + 1 == nbuckets ? 0 : bucket + 1;
+    buckets[bucket] = (hash & 0xFF) << 24 | pos;
+    memcpy(records + pos, entry->strokes, entry->nstrokes);
+    pos += entry->nstrokes;
+    records[pos - 1] |= DICT_LAST_STROKE;
+    records[pos++] = entry->text_len;
+    memcpy(records + pos, entry->text, entry->text_len);
+    pos += entry->text_len;
+    if (entry->nstrokes > max_strokes)
+      max_strokes = entry->nstrokes;
+  }
+  free(kept);
+
+  header->magic = DICT_BLOB_MAGIC;
+  header->version = DICT_BLOB_VERSION;
+  header->max_strokes = max_strokes;
+  header->buckets = nbuckets;
+  header->entries = nkept;
+  header->records_size = pos;
+  header->crc32 = esp_crc32_le(0, (const uint8_t *) buckets, nbuckets * sizeof(uint32_t) + pos);
+  return blob;
+}
@@ -0,0 +1,23 @@
+#ifndef _DICT_BUILD_H_
+#define _DICT_BUILD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chorder_dict.h"
+
+typedef struct {
+  uint8_t strokes[DICT_MAX_STROKES];
+  uint8_t nstrokes;
+  uint8_t text_len;
+  const char *text;
+} dict_entry_t;
+
+/* Lays entries out as a dictionary blob (see main/chorder_dict.h), with the
+ * hash table no more than three quarters full. Later entries for the same
+ * outline replace earlier ones. Returns a malloc()ed blob, or NULL if the
+ * records don't fit in the 24 bits buckets have for their offsets.
+ */
+uint8_t *dict_build(const dict_entry_t *entries, size_t count, size_t *size);
+
+#endif
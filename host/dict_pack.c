@@ -0,0 +1,194 @@
+/* Packs a steno-style dictionary into a blob for the "dict" data partition:
+ *
+ *   dict_pack words.dict dict.bin
+ *   parttool.py write_partition --partition-name dict --input dict.bin
+ *
+ * A dictionary has one outline per line: its strokes as key letters joined
+ * by slashes, a tab, and the text it types. Text is taken verbatim to the end
+ * of the line, bar \n, \t, \s (space) and \\ escapes; words typically end in
+ * a space. Blank lines and lines starting with # are skipped:
+ *
+ *   CI/MR	together\s
+ *
+ * The blob has to fit the dict partition, as sized in the partition table
+ * (partitions_example.csv unless told otherwise); nothing is written if not.
+ *
+ * Usage: dict_pack [-p partitions.csv] <dictionary> <output>
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "keymap_spec.h"
+#include "dict_build.h"
+
+static bool parse_outline(char *outline, dict_entry_t *entry)
+{
+  entry->nstrokes = 0;
+  for (char *token = strtok(outline, "/"); NULL != token; token = strtok(NULL, "/")) {
+    if (DICT_MAX_STROKES == entry->nstrokes || !keymap_chord_parse(token, &entry->strokes[entry->nstrokes]))
+      return false;
+    entry->nstrokes++;
+  }
+  return 0 != entry->nstrokes;
+}
+
+static bool parse_text(const char *text, char *buf, uint8_t *len)
+{
+  size_t pos = 0;
+  for (const char *p = text; '\0' != *p && '\n' != *p && '\r' != *p; p++) {
+    char c = *p;
+    if ('\\' == c) {
+      switch (*++p) {
+        case 'n': c = '\n'; break;
+        case 't': c = '\t'; break;
+        case 's': c = ' '; break;
+        case '\\': c = '\\'; break;
+        default: return false;
+      }
+    }
+    if (UINT8_MAX == pos)
+      return false;
+    buf[pos++] = c;
+  }
+  *len = (uint8_t) pos;
+  return true;
+}
+
+static char *trim(char *field)
+{
+  while (isspace((unsigned char) *field))
+    field++;
+  char *end = field + strlen(field);
+  while (end > field && isspace((unsigned char) end[-1]))
+    *--end = '\0';
+  return field;
+}
+
+// The size of the dict partition in a partition table, as gen_esp32part.py
+// reads it (in bytes, or with a K or M suffix); 0 if there's none:
+static size_t partition_size(const char *path)
+{
+  FILE *in = fopen(path, "r");
+  if (NULL == in) {
+    perror(path);
+    return 0;
+  }
+  char line[256];
+  size_t size = 0;
+  while (0 == size && fgets(line, sizeof(line), in)) {
+    char *fields[5];
+    int nfields = 0;
+    for (char *field = line; nfields < 5 && NULL != field; nfields++) {
+      fields[nfields] = field;
+      field = strchr(field, ',');
+      if (NULL != field)
+        *field++ = '\0';
+    }
+    if (5 != nfields || 0 != strcmp(trim(fields[0]), "dict"))
+      continue;
+    char *suffix;
+    size = strtoul(trim(fields[4]), &suffix, 0);
+    if ('K' == toupper((unsigned char) *suffix))
+      size *= 1024;
+    else if ('M' == toupper((unsigned char) *suffix))
+      size *= 1024 * 1024;
+  }
+  fclose(in);
+  if (0 == size)
+    fprintf(stderr, "%s: no dict partition\n", path);
+  return size;
+}
+
+int main(int argc, char **argv)
+{
+  const char *partitions = DICT_PACK_PARTITIONS;
+  int opt;
+  while (-1 != (opt = getopt(argc, argv, "p:"))) {
+    switch (opt) {
+      case 'p': partitions = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-p partitions.csv] <dictionary> <output>\n", argv[0]);
+        return 2;
+    }
+  }
+  if (optind + 2 != argc) {
+    fprintf(stderr, "Usage: %s [-p partitions.csv] <dictionary> <output>\n", argv[0]);
+    return 2;
+  }
+  const char *dict_path = argv[optind];
+  const char *out_path = argv[optind + 1];
+  size_t partition = partition_size(partitions);
+  if (0 == partition)
+    return 1;
+  FILE *in = fopen(dict_path, "r");
+  if (NULL == in) {
+    perror(dict_path);
+    return 1;
+  }
+
+  dict_entry_t *entries = NULL;
+  size_t count = 0, capacity = 0;
+  char line[1024];
+  unsigned lineno = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), in)) {
+    lineno++;
+    if ('#' == line[0] || '\n' == line[0] || '\0' == line[0])
+      continue;
+    char *tab = strchr(line, '\t');
+    if (NULL == tab) {
+      fprintf(stderr, "%s:%u: no tab between outline and text\n", dict_path, lineno);
+      ok = false;
+      continue;
+    }
+    *tab = '\0';
+
+    if (count == capacity) {
+      capacity = capacity ? 2 * capacity : 4096;
+      entries = realloc(entries, capacity * sizeof(*entries));
+      if (NULL == entries) {
+        perror("realloc");
+        return 1;
+      }
+    }
+    dict_entry_t *entry = &entries[count];
+    char text[UINT8_MAX];
+    if (!parse_outline(line, entry)) {
+      fprintf(stderr, "%s:%u: bad outline %s\n", dict_path, lineno, line);
+      ok = false;
+    } else if (!parse_text(tab + 1, text, &entry->text_len)) {
+      fprintf(stderr, "%s:%u: text too long, or a bad escape\n", dict_path, lineno);
+      ok = false;
+    } else {
+      entry->text = memcpy(malloc(entry->text_len + 1), text, entry->text_len);
+      count++;
+    }
+  }
+  fclose(in);
+  if (!ok)
+    return 1;
+
+  // The blob is laid out as on the (little-endian) ESP32, as is the host:
+  size_t size;
+  uint8_t *blob = dict_build(entries, count, &size);
+  if (NULL == blob)
+    return 1;
+  const dict_blob_header_t *header = (const dict_blob_header_t *) blob;
+  if (size > partition) {
+    fprintf(stderr, "%u outlines take %zu bytes, more than the %zu byte dict partition in %s\n",
+        (unsigned) header->entries, size, partition, partitions);
+    return 1;
+  }
+  FILE *out = fopen(out_path, "wb");
+  if (NULL == out || 1 != fwrite(blob, size, 1, out) || 0 != fclose(out)) {
+    perror(out_path);
+    return 1;
+  }
+  printf("%u outlines (up to %u strokes) in %u buckets, %zu bytes (%.1f%% of the partition)\n",
+      (unsigned) header->entries, header->max_strokes, (unsigned) header->buckets, size,
+      100.0 * size / partition);
+  return 0;
+}
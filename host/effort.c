@@ -0,0 +1,51 @@
+#include "effort.h"
+
+// Per key bit, P R M I N C F; the pinky and the far thumb key are the reach:
+static const double key_effort[7] = { 1.6, 1.3, 1.0, 1.0, 1.0, 1.2, 1.4 };
+#define EFFORT_PER_EXTRA_KEY 0.4
+#define EFFORT_PER_SKIPPED_FINGER 0.5
+
+static double keys_effort(uint8_t keys)
+{
+  double effort = 0;
+  for (int bit = 0; bit < 7; bit++)
+    if (keys & (1 << bit))
+      effort += key_effort[bit];
+  return effort;
+}
+
+// What holding a chord down costs, whichever of its keys are pressed for it:
+static double shape_effort(uint8_t chord)
+{
+  uint8_t fingers = chord & 0x0f;
+  int skipped = 0;
+  if (fingers) {
+    int low = __builtin_ctz(fingers), high = 31 - __builtin_clz(fingers);
+    skipped = high - low + 1 - __builtin_popcount(fingers);
+  }
+  return EFFORT_PER_EXTRA_KEY * (__builtin_popcount(chord) - 1) + EFFORT_PER_SKIPPED_FINGER * skipped;
+}
+
+static uint8_t cheapest_key(uint8_t keys)
+{
+  uint8_t best = 0;
+  for (int bit = 0; bit < 7; bit++)
+    if ((keys & (1 << bit)) && (0 == best || key_effort[bit] < keys_effort(best)))
+      best = 1 << bit;
+  return best;
+}
+
+/* The keys of previous that aren't in next are released, committing it, and
+ * those of next that weren't held are pressed. If that releases nothing, one
+ * key has to come up and go down again to commit previous; if it presses
+ * nothing, one has to for next.
+ */
+double effort_transition(uint8_t previous, uint8_t next)
+{
+  uint8_t pressed = next & ~previous;
+  if (0 != previous && 0 == (previous & ~next))
+    pressed |= cheapest_key(previous);
+  if (0 == pressed)
+    pressed = cheapest_key(next);
+  return keys_effort(pressed) + shape_effort(next);
+}
@@ -0,0 +1,18 @@
+#ifndef _EFFORT_H_
+#define _EFFORT_H_
+
+#include <stdint.h>
+
+/* Effort model for typing chords (as FCN IMRP keyStates), shared by the
+ * layout optimizer and the transition table keymap_gen precomputes.
+ *
+ * Effort is counted per key pressed, weighed by finger, plus a little for
+ * how many keys a chord takes and for fingers skipped in between. Keys held
+ * over from one chord into the next cost nothing, as in the A (C+IMR), E
+ * (IMR), S (MRP) example of the README.
+ */
+
+// Typing chord next right after chord previous, or from scratch if that's 0:
+double effort_transition(uint8_t previous, uint8_t next);
+
+#endif
@@ -0,0 +1,154 @@
+/* Generates main/chorder_keymap.[ch] from a declarative chord spec, and
+ * prints how densely the keymap is populated.
+ *
+ * Usage: keymap_gen <spec> <output directory>
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "keymap_spec.h"
+#include "effort.h"
+
+static void upcase(char *dest, const char *src)
+{
+  while ((*dest++ = toupper((unsigned char) *src++)))
+    ;
+}
+
+static FILE *open_output(const char *dir, const char *name)
+{
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/%s", dir, name);
+  FILE *out = fopen(path, "w");
+  if (NULL == out) {
+    perror(path);
+    exit(1);
+  }
+  return out;
+}
+
+static void write_header(const keymap_spec_t *spec, const char *spec_path, FILE *out)
+{
+  char layer[KEYMAP_SPEC_NAME_MAX];
+  fprintf(out, "// Generated by host/keymap_gen from %s; edit that instead.\n", spec_path);
+  fprintf(out, "#ifndef _CHORDER_KEYMAP_H_\n#define _CHORDER_KEYMAP_H_\n\n");
+  fprintf(out, "#include \"chordmappings.h\"\n\n");
+  fprintf(out, "#define KEYMAP_CHORDS %d\n\n", KEYMAP_SPEC_CHORDS);
+  fprintf(out, "// As per keymap_symbols_fingerprint(), for keymap blobs to match:\n");
+  fprintf(out, "#define KEYMAP_SYMBOLS_FINGERPRINT 0x%08XUL\n\n", (unsigned) keymap_symbols_fingerprint());
+  fprintf(out, "enum keymap_layer {\n");
+  for (unsigned l = 0; l < spec->layers; l++) {
+    upcase(layer, spec->layer_names[l]);
+    fprintf(out, "  KEYMAP_%s,\n", layer);
+  }
+  fprintf(out, "  KEYMAP_LAYERS\n};\n\n");
+  fprintf(out, "// Symbol per chord (as a FCN IMRP keyState) and layer; lives in flash:\n");
+  fprintf(out, "extern const symbol_t keymap_builtin[KEYMAP_CHORDS][KEYMAP_LAYERS];\n\n");
+  fprintf(out, "// The keymap in use: keymap_builtin unless one was loaded at runtime:\n");
+  fprintf(out, "extern const symbol_t (*keymap)[KEYMAP_LAYERS];\n\n");
+  fprintf(out, "// Bit per chord pair, [previous][next / 8] & 1 << next %% 8, set where next is\n");
+  fprintf(out, "// less effort typed holding over keys from previous than from scratch:\n");
+  fprintf(out, "extern const uint8_t keymap_holdover[KEYMAP_CHORDS][KEYMAP_CHORDS / 8];\n\n");
+  fprintf(out, "#endif\n");
+}
+
+static void write_table(const keymap_spec_t *spec, const char *spec_path, FILE *out)
+{
+  char letters[9];
+  fprintf(out, "// Generated by host/keymap_gen from %s; edit that instead.\n", spec_path);
+  fprintf(out, "#include \"hid_dev.h\"\n#include \"chorder_keymap.h\"\n\n");
+  fprintf(out, "const symbol_t keymap_builtin[KEYMAP_CHORDS][KEYMAP_LAYERS] = {\n");
+  for (int chord = 0; chord < KEYMAP_SPEC_CHORDS; chord++) {
+    keymap_chord_letters(chord, letters);
+    fprintf(out, "  /* %s 0x%02X */ {", letters, chord);
+    for (unsigned l = 0; l < spec->layers; l++)
+      fprintf(out, " %s%s", spec->spelling[chord][l], l + 1 < spec->layers ? "," : " ");
+    fprintf(out, "},\n");
+  }
+  fprintf(out, "};\n\n");
+  fprintf(out, "const symbol_t (*keymap)[KEYMAP_LAYERS] = keymap_builtin;\n");
+}
+
+// Which keys chords share doesn't depend on what they type, so this is the
+// same for every layer, and for keymaps loaded at runtime:
+static void write_holdover(FILE *out)
+{
+  char letters[9];
+  fprintf(out, "\n// As per host/effort.c:\n");
+  fprintf(out, "const uint8_t keymap_holdover[KEYMAP_CHORDS][KEYMAP_CHORDS / 8] = {\n");
+  for (int previous = 0; previous < KEYMAP_SPEC_CHORDS; previous++) {
+    keymap_chord_letters(previous, letters);
+    fprintf(out, "  /* %s */ {", letters);
+    for (int byte = 0; byte < KEYMAP_SPEC_CHORDS / 8; byte++) {
+      uint8_t bits = 0;
+      for (int bit = 0; bit < 8; bit++) {
+        uint8_t next = byte * 8 + bit;
+        if (0 != previous && 0 != next && effort_transition(previous, next) < effort_transition(0, next))
+          bits |= 1 << bit;
+      }
+      fprintf(out, " 0x%02X%s", bits, byte + 1 < KEYMAP_SPEC_CHORDS / 8 ? "," : " ");
+    }
+    fprintf(out, "},\n");
+  }
+  fprintf(out, "};\n");
+}
+
+static void print_stats(const keymap_spec_t *spec)
+{
+  unsigned filled_total = 0;
+  unsigned listed = 0;
+  for (int chord = 1; chord < KEYMAP_SPEC_CHORDS; chord++)
+    listed += spec->listed[chord];
+  printf("%u of %d chords mapped, over %u layers\n", listed, KEYMAP_SPEC_CHORDS - 1, spec->layers);
+
+  for (unsigned l = 0; l < spec->layers; l++) {
+    unsigned filled = 0;
+    for (int chord = 1; chord < KEYMAP_SPEC_CHORDS; chord++)
+      filled += spec->symbols[chord][l] != spec->empty[l];
+    filled_total += filled;
+    printf("  %-16s %3u chords (%5.1f%%)\n", spec->layer_names[l], filled,
+        100.0 * filled / (KEYMAP_SPEC_CHORDS - 1));
+  }
+  unsigned cells = (KEYMAP_SPEC_CHORDS - 1) * spec->layers;
+  printf("%u of %u cells filled (%.1f%%)\n", filled_total, cells, 100.0 * filled_total / cells);
+
+  // What deduplicating identical rows (all-empty ones, mostly) would save,
+  // at the cost of an extra indirection per lookup:
+  unsigned distinct = 0;
+  for (int chord = 0; chord < KEYMAP_SPEC_CHORDS; chord++) {
+    bool seen = false;
+    for (int other = 0; other < chord && !seen; other++)
+      seen = 0 == memcmp(spec->symbols[chord], spec->symbols[other], spec->layers * sizeof(symbol_t));
+    distinct += !seen;
+  }
+  size_t dense = KEYMAP_SPEC_CHORDS * spec->layers * sizeof(symbol_t);
+  size_t deduplicated = KEYMAP_SPEC_CHORDS + distinct * spec->layers * sizeof(symbol_t);
+  printf("table: %zu bytes of flash, one load per lookup\n", dense);
+  printf("  (%u distinct rows; %zu bytes if deduplicated, two loads per lookup)\n", distinct, deduplicated);
+}
+
+int main(int argc, char **argv)
+{
+  if (3 != argc) {
+    fprintf(stderr, "Usage: %s <spec> <output directory>\n", argv[0]);
+    return 2;
+  }
+  static keymap_spec_t spec;
+  if (!keymap_spec_load(&spec, argv[1]))
+    return 1;
+
+  // Only the file name goes into generated sources, to keep them stable:
+  const char *spec_name = strrchr(argv[1], '/') ? strrchr(argv[1], '/') + 1 : argv[1];
+  FILE *out = open_output(argv[2], "chorder_keymap.h");
+  write_header(&spec, spec_name, out);
+  fclose(out);
+  out = open_output(argv[2], "chorder_keymap.c");
+  write_table(&spec, spec_name, out);
+  write_holdover(out);
+  fclose(out);
+
+  print_stats(&spec);
+  return 0;
+}
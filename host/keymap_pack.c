@@ -0,0 +1,91 @@
+/* Packs a chord spec into a keymap blob for the "keymap" data partition, so
+ * a layout can be swapped without reflashing the app:
+ *
+ *   keymap_pack -n dvorak dvorak.chords keymap.bin
+ *   parttool.py write_partition --partition-name keymap --input keymap.bin
+ *
+ * Usage: keymap_pack [-n name] <spec> <output>
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_crc.h"
+#include "keymap_spec.h"
+#include "chorder_keymap_partition.h"
+
+int main(int argc, char **argv)
+{
+  const char *name = NULL;
+  int opt;
+  while (-1 != (opt = getopt(argc, argv, "n:"))) {
+    switch (opt) {
+      case 'n': name = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-n name] <spec> <output>\n", argv[0]);
+        return 2;
+    }
+  }
+  if (optind + 2 != argc) {
+    fprintf(stderr, "Usage: %s [-n name] <spec> <output>\n", argv[0]);
+    return 2;
+  }
+  const char *spec_path = argv[optind];
+  const char *out_path = argv[optind + 1];
+
+  static keymap_spec_t spec;
+  if (!keymap_spec_load(&spec, spec_path))
+    return 1;
+  if (KEYMAP_SYMBOLS_FINGERPRINT != keymap_symbols_fingerprint())
+    fprintf(stderr, "warning: symbols are numbered differently from the firmware's chorder_keymap.h; it will ignore this keymap\n");
+  if (KEYMAP_LAYERS != spec.layers)
+    fprintf(stderr, "warning: %s has %u layers, but the firmware has %d; it will ignore this keymap\n",
+        spec_path, spec.layers, KEYMAP_LAYERS);
+
+  // Symbols are little-endian, on the host as on the ESP32:
+  size_t symbols_size = KEYMAP_SPEC_CHORDS * spec.layers * 2;
+  uint8_t *symbols = malloc(symbols_size);
+  size_t pos = 0;
+  for (int chord = 0; chord < KEYMAP_SPEC_CHORDS; chord++) {
+    for (unsigned l = 0; l < spec.layers; l++) {
+      symbols[pos++] = spec.symbols[chord][l] & 0xFF;
+      symbols[pos++] = spec.symbols[chord][l] >> 8;
+    }
+  }
+
+  // Layouts are named after their spec file, unless told otherwise:
+  char default_name[KEYMAP_BLOB_NAME_MAX + 1];
+  if (NULL == name) {
+    const char *base = strrchr(spec_path, '/') ? strrchr(spec_path, '/') + 1 : spec_path;
+    snprintf(default_name, sizeof(default_name), "%.*s", (int) strcspn(base, "."), base);
+    name = default_name;
+  }
+  keymap_blob_header_t header = {
+    .magic = KEYMAP_BLOB_MAGIC,
+    .version = KEYMAP_BLOB_VERSION,
+    .chords = KEYMAP_SPEC_CHORDS,
+    .layers = spec.layers,
+    .crc32 = esp_crc32_le(0, symbols, symbols_size),
+    .fingerprint = keymap_symbols_fingerprint(),
+  };
+  memcpy(header.name, name, strlen(name) < sizeof(header.name) ? strlen(name) : sizeof(header.name));
+  if (strlen(name) > sizeof(header.name))
+    fprintf(stderr, "warning: name truncated to %d characters\n", KEYMAP_BLOB_NAME_MAX);
+
+  FILE *out = fopen(out_path, "wb");
+  if (NULL == out) {
+    perror(out_path);
+    return 1;
+  }
+  if (1 != fwrite(&header, sizeof(header), 1, out) || 1 != fwrite(symbols, symbols_size, 1, out)) {
+    perror(out_path);
+    return 1;
+  }
+  fclose(out);
+  free(symbols);
+
+  printf("%s: keymap \"%.*s\", %u layers, %zu bytes, crc32 %08x\n", out_path,
+      KEYMAP_BLOB_NAME_MAX, header.name, spec.layers, sizeof(header) + symbols_size, (unsigned) header.crc32);
+  return 0;
+}
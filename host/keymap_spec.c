@@ -0,0 +1,170 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "keymap_spec.h"
+
+static const char chord_letters[] = "FCNIMRP";
+
+void keymap_chord_letters(uint8_t chord, char buf[9])
+{
+  for (int i = 0, pos = 0; i < 7; i++, pos++) {
+    if (3 == i)
+      buf[pos++] = ' ';
+    buf[pos] = chord & (1 << (6 - i)) ? chord_letters[i] : '-';
+  }
+  buf[8] = '\0';
+}
+
+// Splits off the next token, keeping character literals (even ' ' and '#')
+// whole; returns NULL at the end of the line or at a comment:
+static char *next_token(char **line)
+{
+  char *p = *line;
+  while (isspace((unsigned char) *p))
+    p++;
+  if ('\0' == *p || '#' == *p)
+    return NULL;
+
+  char *token = p;
+  if ('\'' == *p) {
+    p++;
+    if ('\\' == *p)
+      p++;
+    if ('\0' != *p)
+      p++;
+    if ('\'' == *p)
+      p++;
+  } else {
+    while ('\0' != *p && !isspace((unsigned char) *p))
+      p++;
+  }
+  if ('\0' != *p)
+    *p++ = '\0';
+  *line = p;
+  return token;
+}
+
+static bool parse_symbol(const char *token, symbol_t *value)
+{
+  size_t len = strlen(token);
+  if (len >= 3 && '\'' == token[0] && '\'' == token[len - 1]) {
+    if (3 == len) {
+      *value = (unsigned char) token[1];
+      return true;
+    }
+    if (4 == len && '\\' == token[1]) {
+      switch (token[2]) {
+        case 'n':  *value = '\n'; return true;
+        case 't':  *value = '\t'; return true;
+        case '\\': *value = '\\'; return true;
+        case '\'': *value = '\''; return true;
+      }
+    }
+    return false;
+  }
+  return keymap_symbol_value(token, value);
+}
+
+bool keymap_chord_parse(const char *token, uint8_t *chord)
+{
+  *chord = 0;
+  for (const char *p = token; *p; p++) {
+    const char *letter = strchr(chord_letters, toupper((unsigned char) *p));
+    if (NULL == letter)
+      return false;
+    uint8_t bit = 1 << (6 - (letter - chord_letters));
+    if (*chord & bit)
+      return false;
+    *chord |= bit;
+  }
+  return 0 != *chord;
+}
+
+bool keymap_spec_load(keymap_spec_t *spec, const char *path)
+{
+  FILE *in = fopen(path, "r");
+  if (NULL == in) {
+    perror(path);
+    return false;
+  }
+  memset(spec, 0, sizeof(*spec));
+
+  char line[1024];
+  unsigned lineno = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), in)) {
+    lineno++;
+    char *rest = line;
+    char *token = next_token(&rest);
+    if (NULL == token)
+      continue;
+
+    if (0 == strcmp(token, "layer")) {
+      char *name = next_token(&rest);
+      char *empty = next_token(&rest);
+      if (NULL == name || NULL == empty || strlen(name) >= KEYMAP_SPEC_NAME_MAX) {
+        fprintf(stderr, "%s:%u: expected 'layer <name> <empty symbol>'\n", path, lineno);
+        ok = false;
+      } else if (KEYMAP_SPEC_MAX_LAYERS == spec->layers) {
+        fprintf(stderr, "%s:%u: more than %d layers\n", path, lineno, KEYMAP_SPEC_MAX_LAYERS);
+        ok = false;
+      } else if (!parse_symbol(empty, &spec->empty[spec->layers])) {
+        fprintf(stderr, "%s:%u: unknown symbol %s\n", path, lineno, empty);
+        ok = false;
+      } else {
+        strcpy(spec->layer_names[spec->layers], name);
+        // Chords default to empty on the new layer:
+        for (int chord = 0; chord < KEYMAP_SPEC_CHORDS; chord++) {
+          spec->symbols[chord][spec->layers] = spec->empty[spec->layers];
+          strcpy(spec->spelling[chord][spec->layers], empty);
+        }
+        spec->layers++;
+      }
+      continue;
+    }
+
+    uint8_t chord;
+    if (!keymap_chord_parse(token, &chord)) {
+      fprintf(stderr, "%s:%u: bad chord %s\n", path, lineno, token);
+      ok = false;
+      continue;
+    }
+    if (spec->listed[chord]) {
+      fprintf(stderr, "%s:%u: chord %s listed twice\n", path, lineno, token);
+      ok = false;
+      continue;
+    }
+    spec->listed[chord] = true;
+
+    unsigned layer = 0;
+    while (NULL != (token = next_token(&rest))) {
+      if (layer == spec->layers) {
+        fprintf(stderr, "%s:%u: more symbols than the %u layers\n", path, lineno, spec->layers);
+        ok = false;
+        break;
+      }
+      if (0 != strcmp(token, ".")) {
+        if (!parse_symbol(token, &spec->symbols[chord][layer]) || strlen(token) >= KEYMAP_SPEC_NAME_MAX) {
+          fprintf(stderr, "%s:%u: unknown symbol %s\n", path, lineno, token);
+          ok = false;
+        } else {
+          strcpy(spec->spelling[chord][layer], token);
+        }
+      }
+      layer++;
+    }
+    if (layer < spec->layers) {
+      fprintf(stderr, "%s:%u: %u symbols for %u layers; use '.' for empty ones\n", path, lineno, layer, spec->layers);
+      ok = false;
+    }
+  }
+  fclose(in);
+
+  if (ok && 0 == spec->layers) {
+    fprintf(stderr, "%s: no layers declared\n", path);
+    ok = false;
+  }
+  return ok;
+}
@@ -0,0 +1,41 @@
+#ifndef _KEYMAP_SPEC_H_
+#define _KEYMAP_SPEC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "chordmappings.h"
+
+/* A keymap as declared in a chord spec (see main/keymap.chords), parsed and
+ * resolved on the host for the generators to lay out.
+ */
+#define KEYMAP_SPEC_CHORDS     128
+#define KEYMAP_SPEC_MAX_LAYERS 16
+#define KEYMAP_SPEC_NAME_MAX   48
+
+typedef struct {
+  unsigned layers;
+  char layer_names[KEYMAP_SPEC_MAX_LAYERS][KEYMAP_SPEC_NAME_MAX];
+  symbol_t empty[KEYMAP_SPEC_MAX_LAYERS];
+  bool listed[KEYMAP_SPEC_CHORDS];
+  symbol_t symbols[KEYMAP_SPEC_CHORDS][KEYMAP_SPEC_MAX_LAYERS];
+  // Each symbol as spelled in the spec, for generated sources to keep using:
+  char spelling[KEYMAP_SPEC_CHORDS][KEYMAP_SPEC_MAX_LAYERS][KEYMAP_SPEC_NAME_MAX];
+} keymap_spec_t;
+
+// Parses a chord spec, reporting errors on stderr as file:line: ...
+bool keymap_spec_load(keymap_spec_t *spec, const char *path);
+
+// Parses a chord written as its key letters, e.g. "CIMR"; false if malformed:
+bool keymap_chord_parse(const char *token, uint8_t *chord);
+// Writes a chord as its key letters, e.g. "-C- IMR-", into buf (9 bytes):
+void keymap_chord_letters(uint8_t chord, char buf[9]);
+
+// Symbol names, as per keymap_symbols.c:
+bool keymap_symbol_value(const char *name, symbol_t *value);
+const char *keymap_symbol_name(symbol_t value);
+// A hash of every symbol's name and value, for telling keymap blobs resolved
+// against other symbol numbering apart:
+uint32_t keymap_symbols_fingerprint(void);
+
+#endif
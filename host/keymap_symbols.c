@@ -0,0 +1,233 @@
+/* Names of every symbol a keymap spec may use, for resolving them on the host
+ * without the preprocessor. Keep in step with hid_dev.h and chordmappings.h.
+ */
+#include <stddef.h>
+#include <string.h>
+
+#include "keymap_spec.h"
+
+#define SYMBOL(name) { #name, name }
+
+static const struct {
+  const char *name;
+  symbol_t value;
+} symbols[] = {
+  SYMBOL(HID_KEY_RESERVED),
+  SYMBOL(HID_KEY_A),
+  SYMBOL(HID_KEY_B),
+  SYMBOL(HID_KEY_C),
+  SYMBOL(HID_KEY_D),
+  SYMBOL(HID_KEY_E),
+  SYMBOL(HID_KEY_F),
+  SYMBOL(HID_KEY_G),
+  SYMBOL(HID_KEY_H),
+  SYMBOL(HID_KEY_I),
+  SYMBOL(HID_KEY_J),
+  SYMBOL(HID_KEY_K),
+  SYMBOL(HID_KEY_L),
+  SYMBOL(HID_KEY_M),
+  SYMBOL(HID_KEY_N),
+  SYMBOL(HID_KEY_O),
+  SYMBOL(HID_KEY_P),
+  SYMBOL(HID_KEY_Q),
+  SYMBOL(HID_KEY_R),
+  SYMBOL(HID_KEY_S),
+  SYMBOL(HID_KEY_T),
+  SYMBOL(HID_KEY_U),
+  SYMBOL(HID_KEY_V),
+  SYMBOL(HID_KEY_W),
+  SYMBOL(HID_KEY_X),
+  SYMBOL(HID_KEY_Y),
+  SYMBOL(HID_KEY_Z),
+  SYMBOL(HID_KEY_1),
+  SYMBOL(HID_KEY_2),
+  SYMBOL(HID_KEY_3),
+  SYMBOL(HID_KEY_4),
+  SYMBOL(HID_KEY_5),
+  SYMBOL(HID_KEY_6),
+  SYMBOL(HID_KEY_7),
+  SYMBOL(HID_KEY_8),
+  SYMBOL(HID_KEY_9),
+  SYMBOL(HID_KEY_0),
+  SYMBOL(HID_KEY_RETURN),
+  SYMBOL(HID_KEY_ESCAPE),
+  SYMBOL(HID_KEY_DELETE),
+  SYMBOL(HID_KEY_TAB),
+  SYMBOL(HID_KEY_SPACEBAR),
+  SYMBOL(HID_KEY_MINUS),
+  SYMBOL(HID_KEY_EQUAL),
+  SYMBOL(HID_KEY_LEFT_BRKT),
+  SYMBOL(HID_KEY_RIGHT_BRKT),
+  SYMBOL(HID_KEY_BACK_SLASH),
+  SYMBOL(HID_KEY_NONUS_HASH),
+  SYMBOL(HID_KEY_SEMI_COLON),
+  SYMBOL(HID_KEY_SGL_QUOTE),
+  SYMBOL(HID_KEY_GRV_ACCENT),
+  SYMBOL(HID_KEY_COMMA),
+  SYMBOL(HID_KEY_DOT),
+  SYMBOL(HID_KEY_FWD_SLASH),
+  SYMBOL(HID_KEY_CAPS_LOCK),
+  SYMBOL(HID_KEY_F1),
+  SYMBOL(HID_KEY_F2),
+  SYMBOL(HID_KEY_F3),
+  SYMBOL(HID_KEY_F4),
+  SYMBOL(HID_KEY_F5),
+  SYMBOL(HID_KEY_F6),
+  SYMBOL(HID_KEY_F7),
+  SYMBOL(HID_KEY_F8),
+  SYMBOL(HID_KEY_F9),
+  SYMBOL(HID_KEY_F10),
+  SYMBOL(HID_KEY_F11),
+  SYMBOL(HID_KEY_F12),
+  SYMBOL(HID_KEY_PRNT_SCREEN),
+  SYMBOL(HID_KEY_SCROLL_LOCK),
+  SYMBOL(HID_KEY_PAUSE),
+  SYMBOL(HID_KEY_INSERT),
+  SYMBOL(HID_KEY_HOME),
+  SYMBOL(HID_KEY_PAGE_UP),
+  SYMBOL(HID_KEY_DELETE_FWD),
+  SYMBOL(HID_KEY_END),
+  SYMBOL(HID_KEY_PAGE_DOWN),
+  SYMBOL(HID_KEY_RIGHT_ARROW),
+  SYMBOL(HID_KEY_LEFT_ARROW),
+  SYMBOL(HID_KEY_DOWN_ARROW),
+  SYMBOL(HID_KEY_UP_ARROW),
+  SYMBOL(HID_KEY_NUM_LOCK),
+  SYMBOL(HID_KEY_DIVIDE),
+  SYMBOL(HID_KEY_MULTIPLY),
+  SYMBOL(HID_KEY_SUBTRACT),
+  SYMBOL(HID_KEY_ADD),
+  SYMBOL(HID_KEY_ENTER),
+  SYMBOL(HID_KEYPAD_1),
+  SYMBOL(HID_KEYPAD_2),
+  SYMBOL(HID_KEYPAD_3),
+  SYMBOL(HID_KEYPAD_4),
+  SYMBOL(HID_KEYPAD_5),
+  SYMBOL(HID_KEYPAD_6),
+  SYMBOL(HID_KEYPAD_7),
+  SYMBOL(HID_KEYPAD_8),
+  SYMBOL(HID_KEYPAD_9),
+  SYMBOL(HID_KEYPAD_0),
+  SYMBOL(HID_KEYPAD_DOT),
+  SYMBOL(HID_KEY_NONUS_BACK_SLASH),
+  SYMBOL(HID_KEY_MUTE),
+  SYMBOL(HID_KEY_VOLUME_UP),
+  SYMBOL(HID_KEY_VOLUME_DOWN),
+  SYMBOL(HID_KEY_LEFT_CTRL),
+  SYMBOL(HID_KEY_LEFT_SHIFT),
+  SYMBOL(HID_KEY_LEFT_ALT),
+  SYMBOL(HID_KEY_LEFT_GUI),
+  SYMBOL(HID_KEY_RIGHT_CTRL),
+  SYMBOL(HID_KEY_RIGHT_SHIFT),
+  SYMBOL(HID_KEY_RIGHT_ALT),
+  SYMBOL(HID_KEY_RIGHT_GUI),
+  SYMBOL(MOD_LCTRL),
+  SYMBOL(MOD_LSHIFT),
+  SYMBOL(MOD_LALT),
+  SYMBOL(MOD_LGUI),
+  SYMBOL(MOD_RCTRL),
+  SYMBOL(MOD_RSHIFT),
+  SYMBOL(MOD_RALT),
+  SYMBOL(MOD_RGUI),
+  SYMBOL(MODE_RESET),
+  SYMBOL(MODE_MRESET),
+  SYMBOL(MODE_NUM),
+  SYMBOL(MODE_NUMLCK),
+  SYMBOL(MODE_FUNC),
+  SYMBOL(MODE_FUNCLCK),
+  SYMBOL(MODE_NOTETAKING),
+  SYMBOL(MODE_BLE_KEYBOARD),
+  SYMBOL(MODE_BLE_MOUSE),
+  SYMBOL(MODE_DEEPSLEEP),
+  SYMBOL(MODE_DUMP_STATS),
+  SYMBOL(NONBLE_NOKEY),
+  SYMBOL(NONBLE_LEFTARR),
+  SYMBOL(NONBLE_DOWNARR),
+  SYMBOL(NONBLE_UPARR),
+  SYMBOL(NONBLE_RIGHTARR),
+  SYMBOL(NONBLE_BACKSPACE),
+  SYMBOL(MULTI_NumShift),
+  SYMBOL(MULTI_CtlAlt),
+  SYMBOL(BLEMOUSE_LEFT),
+  SYMBOL(BLEMOUSE_DOWN),
+  SYMBOL(BLEMOUSE_UP),
+  SYMBOL(BLEMOUSE_RIGHT),
+  SYMBOL(BLEMOUSE_1CLICK),
+  SYMBOL(BLEMOUSE_2CLICK),
+  SYMBOL(BLEMOUSE_3CLICK),
+  SYMBOL(BLEMOUSE_1TOGGLE),
+  SYMBOL(BLEMOUSE_2TOGGLE),
+  SYMBOL(BLEMOUSE_3TOGGLE),
+  SYMBOL(BLEMOUSE_FURTHER),
+  SYMBOL(BLEMOUSE_SHORTER),
+  SYMBOL(MEDIA_playpause),
+  SYMBOL(MEDIA_next),
+  SYMBOL(MEDIA_previous),
+  SYMBOL(MEDIA_stop),
+  SYMBOL(MEDIA_volup),
+  SYMBOL(MEDIA_voldn),
+  SYMBOL(MACRO_000),
+  SYMBOL(MACRO_00),
+  SYMBOL(MACRO_quotes),
+  SYMBOL(MACRO_parens),
+  SYMBOL(MACRO_dollar),
+  SYMBOL(MACRO_percent),
+  SYMBOL(MACRO_ampersand),
+  SYMBOL(MACRO_asterisk),
+  SYMBOL(MACRO_question),
+  SYMBOL(MACRO_plus),
+  SYMBOL(MACRO_openparen),
+  SYMBOL(MACRO_closeparen),
+  SYMBOL(MACRO_opencurly),
+  SYMBOL(MACRO_closecurly),
+  SYMBOL(ANDROID_search),
+  SYMBOL(ANDROID_home),
+  SYMBOL(ANDROID_menu),
+  SYMBOL(ANDROID_back),
+  SYMBOL(ANDROID_dpadcenter),
+  SYMBOL(SNIPPET_0),
+  SYMBOL(SNIPPET_1),
+  SYMBOL(SNIPPET_2),
+  SYMBOL(SNIPPET_3),
+  SYMBOL(SNIPPET_4),
+  SYMBOL(SNIPPET_5),
+  SYMBOL(SNIPPET_6),
+  SYMBOL(SNIPPET_7),
+};
+
+bool keymap_symbol_value(const char *name, symbol_t *value)
+{
+  for (size_t i = 0; i < sizeof(symbols) / sizeof(symbols[0]); i++) {
+    if (0 == strcmp(symbols[i].name, name)) {
+      *value = symbols[i].value;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t keymap_symbols_fingerprint(void)
+{
+  // FNV-1a over each name and its value, so that renumbering the enums
+  // changes it as surely as adding or renaming a symbol does:
+  uint32_t hash = 0x811C9DC5;
+  for (size_t i = 0; i < sizeof(symbols) / sizeof(symbols[0]); i++) {
+    for (const char *c = symbols[i].name; ; c++) {
+      hash = (hash ^ (uint8_t) *c) * 0x01000193;
+      if ('\0' == *c)
+        break;
+    }
+    hash = (hash ^ (symbols[i].value & 0xFF)) * 0x01000193;
+    hash = (hash ^ (symbols[i].value >> 8)) * 0x01000193;
+  }
+  return hash;
+}
+
+const char *keymap_symbol_name(symbol_t value)
+{
+  for (size_t i = 0; i < sizeof(symbols) / sizeof(symbols[0]); i++) {
+    if (symbols[i].value == value)
+      return symbols[i].name;
+  }
+  return NULL;
+}
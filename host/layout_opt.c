@@ -0,0 +1,375 @@
+/* Searches for a keymap that's less effort to type, given chord usage
+ * statistics dumped from the device, and writes it out as a chord spec:
+ *
+ *   layout_opt -o optimized.chords console.log
+ *
+ * The statistics are the UC/UT lines of a stats dump (see chorder_usage.h)
+ * anywhere in a console log. Only the letter layers (by default alpha and the
+ * two note-taking ones, which spell the same letters) are rearranged, and
+ * those move together, so a chord keeps typing the same letter in every mode.
+ * Chords for modes, modifiers and the like stay where they are, as do the
+ * other layers.
+ *
+ * Effort is as per effort.h, in which keys held over from one chord into the
+ * next are free, so transitions are what's scored wherever there are any.
+ * The transition counts are per chord regardless of layer, so are taken as
+ * the letter layers' throughout.
+ *
+ * The search is simulated annealing of chord swaps, one independent run per
+ * core, keeping the best. It stops at -s seconds (default 30) if it hasn't
+ * finished its -i iterations per run by then.
+ *
+ * Usage: layout_opt [-k spec] [-l layer,...] [-i iterations] [-s seconds]
+ *                   [-o output] <console log>
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "keymap_spec.h"
+#include "effort.h"
+#include "chorder_usage.h"
+
+#define CHORDS KEYMAP_SPEC_CHORDS
+
+////////////////////////////////////////////////////////////////////////////////
+// Search
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+/* Rows are identified by the chord they're on in the spec; placement[row] is
+ * the chord it's on now. Row 0 is the start of a session and never moves.
+ */
+static double cost[CHORDS][CHORDS];        // effort, [previous][next] chord
+static double weight[CHORDS][CHORDS];      // transitions, [previous][next] row
+static uint8_t movable[CHORDS];
+static unsigned nmovable;
+
+static double layout_effort(const uint8_t *placement)
+{
+  double effort = 0;
+  for (int a = 0; a < CHORDS; a++)
+    for (int b = 1; b < CHORDS; b++)
+      if (weight[a][b])
+        effort += weight[a][b] * cost[placement[a]][placement[b]];
+  return effort;
+}
+
+// The change in effort if rows i and j swapped chords:
+static double swap_delta(const uint8_t *placement, int i, int j)
+{
+  uint8_t pi = placement[i], pj = placement[j];
+  double delta = 0;
+  for (int k = 0; k < CHORDS; k++) {
+    if (k == i || k == j)
+      continue;
+    uint8_t pk = placement[k];
+    delta += weight[i][k] * (cost[pj][pk] - cost[pi][pk]) + weight[k][i] * (cost[pk][pj] - cost[pk][pi])
+           + weight[j][k] * (cost[pi][pk] - cost[pj][pk]) + weight[k][j] * (cost[pk][pi] - cost[pk][pj]);
+  }
+  delta += weight[i][i] * (cost[pj][pj] - cost[pi][pi]) + weight[j][j] * (cost[pi][pi] - cost[pj][pj])
+         + weight[i][j] * (cost[pj][pi] - cost[pi][pj]) + weight[j][i] * (cost[pi][pj] - cost[pj][pi]);
+  return delta;
+}
+
+typedef struct {
+  unsigned seed;
+  long iterations;
+  double deadline;                         // CLOCK_MONOTONIC seconds
+  uint8_t placement[CHORDS];               // in: the spec's, out: the best found
+  double effort;
+  long done;
+} run_t;
+
+static double now_s(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *anneal(void *arg)
+{
+  run_t *run = arg;
+  unsigned seed = run->seed;
+  uint8_t placement[CHORDS], best[CHORDS];
+  memcpy(placement, run->placement, sizeof(placement));
+  memcpy(best, placement, sizeof(best));
+  double effort = layout_effort(placement), best_effort = effort;
+
+  // Start out hot enough to take a typical uphill swap half the time:
+  double typical = 0;
+  for (int n = 0; n < 1000; n++) {
+    int i = movable[rand_r(&seed) % nmovable], j = movable[rand_r(&seed) % nmovable];
+    typical += fabs(swap_delta(placement, i, j)) / 1000;
+  }
+  double t0 = typical / M_LN2 + 1e-9, t1 = t0 * 1e-4;
+
+  long n;
+  for (n = 0; n < run->iterations; n++) {
+    if (0 == (n & 0xffff) && now_s() > run->deadline)
+      break;
+    int i = movable[rand_r(&seed) % nmovable], j = movable[rand_r(&seed) % nmovable];
+    if (i == j)
+      continue;
+    double t = t0 * pow(t1 / t0, (double) n / run->iterations);
+    double delta = swap_delta(placement, i, j);
+    if (delta > 0 && (double) rand_r(&seed) / RAND_MAX >= exp(-delta / t))
+      continue;
+    uint8_t swap = placement[i];
+    placement[i] = placement[j];
+    placement[j] = swap;
+    effort += delta;
+    if (effort < best_effort - 1e-9) {
+      best_effort = effort;
+      memcpy(best, placement, sizeof(best));
+    }
+  }
+
+  memcpy(run->placement, best, sizeof(best));
+  run->effort = layout_effort(best);
+  run->done = n;
+  return NULL;
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Input and output
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+// Whether a symbol just types something, and so may go on any chord:
+static bool is_output(const keymap_spec_t *spec, unsigned layer, symbol_t symbol)
+{
+  return symbol == spec->empty[layer] || symbol < DIV_nonkeys_offset
+    || (symbol >= DIV_Macro && symbol < DIV_Last);
+}
+
+static bool read_usage(const char *path, double chord_counts[CHORDS], const bool *letter_layer)
+{
+  FILE *in = fopen(path, "r");
+  if (NULL == in) {
+    perror(path);
+    return false;
+  }
+  char line[1024];
+  unsigned found = 0;
+  while (fgets(line, sizeof(line), in)) {
+    unsigned a, b, count;
+    const char *p;
+    if (NULL != (p = strstr(line, USAGE_CHORD_PREFIX))
+        && 3 == sscanf(p + strlen(USAGE_CHORD_PREFIX), "%u %x %u", &a, &b, &count)) {
+      if (a < KEYMAP_SPEC_MAX_LAYERS && b < CHORDS && letter_layer[a])
+        chord_counts[b] += count;
+      found++;
+    } else if (NULL != (p = strstr(line, USAGE_TRANSITION_PREFIX))
+        && 3 == sscanf(p + strlen(USAGE_TRANSITION_PREFIX), "%x %x %u", &a, &b, &count)) {
+      if (a < CHORDS && b < CHORDS)
+        weight[a][b] += count;
+      found++;
+    }
+  }
+  fclose(in);
+  if (0 == found) {
+    fprintf(stderr, "%s: no usage statistics in there\n", path);
+    return false;
+  }
+  return true;
+}
+
+static void write_spec(FILE *out, const keymap_spec_t *spec, const bool *letter_layer,
+    const uint8_t *placement, const char *spec_path)
+{
+  // The row each chord now gets its letter layers from:
+  uint8_t row_on[CHORDS];
+  for (int row = 0; row < CHORDS; row++)
+    row_on[placement[row]] = row;
+
+  size_t width[KEYMAP_SPEC_MAX_LAYERS], name_width = 0;
+  for (unsigned l = 0; l < spec->layers; l++) {
+    width[l] = strlen(spec->layer_names[l]);
+    if (width[l] > name_width)
+      name_width = width[l];
+    for (int chord = 1; chord < CHORDS; chord++)
+      if (strlen(spec->spelling[chord][l]) > width[l])
+        width[l] = strlen(spec->spelling[chord][l]);
+  }
+
+  fprintf(out, "# Rearranged by host/layout_opt from %s.\n\n", spec_path);
+  for (unsigned l = 0; l < spec->layers; l++)
+    fprintf(out, "layer %-*s %s\n", (int) name_width, spec->layer_names[l], keymap_symbol_name(spec->empty[l]));
+  fprintf(out, "\n# %-6s", "chord");
+  for (unsigned l = 0; l < spec->layers; l++)
+    fprintf(out, " %-*s", l + 1 < spec->layers ? (int) width[l] : 0, spec->layer_names[l]);
+  fprintf(out, "\n");
+
+  for (int chord = 1; chord < CHORDS; chord++) {
+    bool listed = false;
+    const char *column[KEYMAP_SPEC_MAX_LAYERS];
+    for (unsigned l = 0; l < spec->layers; l++) {
+      int row = letter_layer[l] ? row_on[chord] : chord;
+      column[l] = spec->symbols[row][l] == spec->empty[l] ? "." : spec->spelling[row][l];
+      listed |= spec->listed[row] && spec->symbols[row][l] != spec->empty[l];
+    }
+    if (!listed)
+      continue;
+    char letters[9], *p = letters;
+    keymap_chord_letters(chord, letters);
+    for (char *q = letters; *q; q++)
+      if ('-' != *q && ' ' != *q)
+        *p++ = *q;
+    *p = '\0';
+    fprintf(out, "%-8s", letters);
+    for (unsigned l = 0; l < spec->layers; l++)
+      fprintf(out, " %-*s", l + 1 < spec->layers ? (int) width[l] : 0, column[l]);
+    fprintf(out, "\n");
+  }
+}
+
+// }}}
+
+int main(int argc, char **argv)
+{
+  const char *spec_path = "main/keymap.chords", *layers = "alpha,note_shifted,note_unshifted";
+  const char *out_path = NULL;
+  long iterations = 4000000;
+  double seconds = 30;
+  int opt;
+  while (-1 != (opt = getopt(argc, argv, "k:l:i:s:o:"))) {
+    switch (opt) {
+      case 'k': spec_path = optarg; break;
+      case 'l': layers = optarg; break;
+      case 'i': iterations = atol(optarg); break;
+      case 's': seconds = atof(optarg); break;
+      case 'o': out_path = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-k spec] [-l layer,...] [-i iterations] [-s seconds] [-o output] <console log>\n", argv[0]);
+        return 2;
+    }
+  }
+  if (optind + 1 != argc || iterations <= 0) {
+    fprintf(stderr, "Usage: %s [-k spec] [-l layer,...] [-i iterations] [-s seconds] [-o output] <console log>\n", argv[0]);
+    return 2;
+  }
+
+  static keymap_spec_t spec;
+  if (!keymap_spec_load(&spec, spec_path))
+    return 1;
+
+  bool letter_layer[KEYMAP_SPEC_MAX_LAYERS] = { false };
+  char names[1024];
+  snprintf(names, sizeof(names), "%s", layers);
+  for (char *name = strtok(names, ","); NULL != name; name = strtok(NULL, ",")) {
+    unsigned l;
+    for (l = 0; l < spec.layers && 0 != strcmp(name, spec.layer_names[l]); l++)
+      ;
+    if (l == spec.layers) {
+      fprintf(stderr, "%s: no layer %s\n", spec_path, name);
+      return 1;
+    }
+    letter_layer[l] = true;
+  }
+
+  double chord_counts[CHORDS] = { 0 };
+  if (!read_usage(argv[optind], chord_counts, letter_layer))
+    return 1;
+  // Without transitions to go by, chords are scored as typed from scratch:
+  double transitions = 0;
+  for (int a = 0; a < CHORDS; a++)
+    for (int b = 1; b < CHORDS; b++)
+      transitions += weight[a][b];
+  if (0 == transitions)
+    for (int b = 1; b < CHORDS; b++)
+      transitions += weight[0][b] = chord_counts[b];
+  if (0 == transitions) {
+    fprintf(stderr, "%s: nothing's been typed on the letter layers\n", argv[optind]);
+    return 1;
+  }
+
+  for (int a = 0; a < CHORDS; a++)
+    for (int b = 1; b < CHORDS; b++)
+      cost[a][b] = effort_transition(a, b);
+
+  // Letters never typed stay put, rather than being shuffled about at random:
+  for (int chord = 1; chord < CHORDS; chord++) {
+    bool output = true, empty = true;
+    double typed = 0;
+    for (unsigned l = 0; l < spec.layers; l++) {
+      if (letter_layer[l]) {
+        output &= is_output(&spec, l, spec.symbols[chord][l]);
+        empty &= spec.symbols[chord][l] == spec.empty[l];
+      }
+    }
+    for (int other = 0; other < CHORDS; other++)
+      typed += weight[other][chord];
+    if (output && (empty || typed > 0))
+      movable[nmovable++] = chord;
+  }
+  if (nmovable < 2) {
+    fprintf(stderr, "%s: fewer than two chords to rearrange\n", spec_path);
+    return 1;
+  }
+
+  uint8_t placement[CHORDS];
+  for (int row = 0; row < CHORDS; row++)
+    placement[row] = row;
+  double baseline = layout_effort(placement);
+
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned nruns = cores > 0 ? (unsigned) cores : 1;
+  run_t *runs = calloc(nruns, sizeof(*runs));
+  pthread_t *threads = calloc(nruns, sizeof(*threads));
+  double started = now_s();
+  for (unsigned r = 0; r < nruns; r++) {
+    runs[r].seed = 0x5eed + r;
+    runs[r].iterations = iterations;
+    runs[r].deadline = started + seconds;
+    memcpy(runs[r].placement, placement, sizeof(placement));
+    pthread_create(&threads[r], NULL, anneal, &runs[r]);
+  }
+  run_t *best = &runs[0];
+  long done = 0;
+  for (unsigned r = 0; r < nruns; r++) {
+    pthread_join(threads[r], NULL);
+    done += runs[r].done;
+    if (runs[r].effort < best->effort)
+      best = &runs[r];
+  }
+
+  printf("%u runs, %ld swaps tried in %.1f s, %u chords rearranged\n",
+      nruns, done, now_s() - started, nmovable);
+  for (int row = 1; row < CHORDS; row++) {
+    if (best->placement[row] == row || !spec.listed[row])
+      continue;
+    char from[9], to[9];
+    keymap_chord_letters(row, from);
+    keymap_chord_letters(best->placement[row], to);
+    for (unsigned l = 0; l < spec.layers; l++) {
+      if (letter_layer[l]) {
+        printf("  %-20s %s -> %s\n", spec.spelling[row][l], from, to);
+        break;
+      }
+    }
+  }
+  printf("effort per chord: %.3f -> %.3f, %.1f%% less\n", baseline / transitions, best->effort / transitions,
+      100 * (baseline - best->effort) / baseline);
+
+  if (NULL != out_path) {
+    FILE *out = fopen(out_path, "w");
+    if (NULL == out) {
+      perror(out_path);
+      return 1;
+    }
+    write_spec(out, &spec, letter_layer, best->placement, spec_path);
+    if (0 != fclose(out)) {
+      perror(out_path);
+      return 1;
+    }
+  }
+  return 0;
+}
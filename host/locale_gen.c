@@ -0,0 +1,333 @@
+/* Generates main/chorder_locale_tables.[ch] from keyboard layout
+ * descriptions (see main/locales), i.e. which keys type which characters on
+ * a host set to each layout, inverted for typing text (see the README):
+ *
+ *   locale_gen <output directory> us.layout de.layout ...
+ *
+ * Locales are numbered in the order given; the first one is the default.
+ *
+ * A layout has a "name <name>" line, then one line per key: its HID_KEY_*
+ * name and what it types plain, shifted and with AltGr (right alt). Each is
+ * a character (in UTF-8, optionally quoted as 'x'), a '.' for nothing, or a
+ * dead key: dead_grave, dead_acute, dead_circumflex, dead_diaeresis or
+ * dead_tilde. Dead keys type their accent over the letter typed next, or on
+ * its own before a space. Space, tab and return are the same everywhere, so
+ * needn't be listed.
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "keymap_spec.h"
+#include "hid_dev.h"
+
+#define MAX_LOCALES 16
+#define MAX_CODEPOINT 0xFFFF
+#define MOD_SHIFT 0x02
+#define MOD_ALTGR 0x40
+
+typedef struct {
+  uint8_t mod, key, dead_mod, dead_key;
+  bool defined;
+} stroke_t;
+
+typedef enum { DEAD_GRAVE, DEAD_ACUTE, DEAD_CIRCUMFLEX, DEAD_DIAERESIS, DEAD_TILDE, DEADS } dead_t;
+
+static const struct {
+  const char *name;
+  uint16_t spacing;                        // what the dead key types before a space
+  const char *bases;                       // letters it goes over
+  const char *composed;                    // ... and what they then make, in UTF-8
+} deads[DEADS] = {
+  [DEAD_GRAVE]      = { "dead_grave",      '`',  "aeiouAEIOU",   "àèìòùÀÈÌÒÙ" },
+  [DEAD_ACUTE]      = { "dead_acute",      0xB4, "aeiouyAEIOUY", "áéíóúýÁÉÍÓÚÝ" },
+  [DEAD_CIRCUMFLEX] = { "dead_circumflex", '^',  "aeiouAEIOU",   "âêîôûÂÊÎÔÛ" },
+  [DEAD_DIAERESIS]  = { "dead_diaeresis",  0xA8, "aeiouyAEIOU",  "äëïöüÿÄËÏÖÜ" },
+  [DEAD_TILDE]      = { "dead_tilde",      '~',  "anoANO",       "ãñõÃÑÕ" },
+};
+
+typedef struct {
+  char name[KEYMAP_SPEC_NAME_MAX];
+  stroke_t strokes[MAX_CODEPOINT + 1];
+  stroke_t dead_strokes[DEADS];
+} layout_t;
+
+static layout_t locales[MAX_LOCALES];
+
+// Decodes one UTF-8 character, advancing *p past it; -1 if malformed:
+static long utf8_decode(const char **p)
+{
+  const unsigned char *s = (const unsigned char *) *p;
+  long cp;
+  int more;
+  if (s[0] < 0x80) {
+    cp = s[0];
+    more = 0;
+  } else if ((s[0] & 0xE0) == 0xC0) {
+    cp = s[0] & 0x1F;
+    more = 1;
+  } else if ((s[0] & 0xF0) == 0xE0) {
+    cp = s[0] & 0x0F;
+    more = 2;
+  } else {
+    return -1;
+  }
+  for (int i = 1; i <= more; i++) {
+    if ((s[i] & 0xC0) != 0x80)
+      return -1;
+    cp = cp << 6 | (s[i] & 0x3F);
+  }
+  *p += 1 + more;
+  return cp;
+}
+
+// The character a token stands for, or -1 if it isn't exactly one:
+static long parse_char(const char *token)
+{
+  size_t len = strlen(token);
+  const char *p = token, *end = token + len;
+  if (len >= 3 && '\'' == token[0] && '\'' == token[len - 1]) {
+    p++;
+    end--;
+  }
+  long cp = utf8_decode(&p);
+  return p == end ? cp : -1;
+}
+
+static void define(layout_t *locale, long cp, uint8_t mod, uint8_t key, uint8_t dead_mod, uint8_t dead_key)
+{
+  stroke_t *stroke = &locale->strokes[cp];
+  // The first (and so plainest) way of typing a character wins:
+  if (stroke->defined)
+    return;
+  *stroke = (stroke_t) { mod, key, dead_mod, dead_key, true };
+}
+
+static bool load_layout(layout_t *locale, const char *path)
+{
+  FILE *in = fopen(path, "r");
+  if (NULL == in) {
+    perror(path);
+    return false;
+  }
+  static const uint8_t column_mods[3] = { 0x00, MOD_SHIFT, MOD_ALTGR };
+  char line[512];
+  unsigned lineno = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), in)) {
+    lineno++;
+    char *tokens[5];
+    int ntokens = 0;
+    for (char *token = strtok(line, " \t\r\n"); NULL != token && ntokens < 5; token = strtok(NULL, " \t\r\n"))
+      tokens[ntokens++] = token;
+    if (0 == ntokens || '#' == tokens[0][0])
+      continue;
+
+    if (0 == strcmp(tokens[0], "name")) {
+      if (2 != ntokens || strlen(tokens[1]) >= KEYMAP_SPEC_NAME_MAX) {
+        fprintf(stderr, "%s:%u: expected 'name <name>'\n", path, lineno);
+        ok = false;
+      } else {
+        strcpy(locale->name, tokens[1]);
+      }
+      continue;
+    }
+
+    symbol_t key;
+    if (4 != ntokens || !keymap_symbol_value(tokens[0], &key) || key >= DIV_nonkeys_offset) {
+      fprintf(stderr, "%s:%u: expected '<HID_KEY_*> <plain> <shift> <altgr>'\n", path, lineno);
+      ok = false;
+      continue;
+    }
+    for (int column = 0; column < 3; column++) {
+      const char *token = tokens[1 + column];
+      if (0 == strcmp(token, "."))
+        continue;
+      if (0 == strncmp(token, "dead_", 5)) {
+        dead_t dead;
+        for (dead = 0; dead < DEADS && 0 != strcmp(token, deads[dead].name); dead++)
+          ;
+        if (DEADS == dead) {
+          fprintf(stderr, "%s:%u: unknown dead key %s\n", path, lineno, token);
+          ok = false;
+        } else if (!locale->dead_strokes[dead].defined) {
+          locale->dead_strokes[dead] = (stroke_t) { column_mods[column], (uint8_t) key, 0, 0, true };
+        }
+        continue;
+      }
+      long cp = parse_char(token);
+      if (cp < 0 || cp > MAX_CODEPOINT) {
+        fprintf(stderr, "%s:%u: %s isn't a single character\n", path, lineno, token);
+        ok = false;
+        continue;
+      }
+      define(locale, cp, column_mods[column], (uint8_t) key, 0, 0);
+    }
+  }
+  fclose(in);
+  if ('\0' == locale->name[0]) {
+    fprintf(stderr, "%s: no name line\n", path);
+    ok = false;
+  }
+  if (!ok)
+    return false;
+
+  define(locale, ' ', 0, HID_KEY_SPACEBAR, 0, 0);
+  define(locale, '\t', 0, HID_KEY_TAB, 0, 0);
+  define(locale, '\n', 0, HID_KEY_RETURN, 0, 0);
+
+  // Whatever's left to type with dead keys:
+  for (dead_t dead = 0; dead < DEADS; dead++) {
+    const stroke_t *d = &locale->dead_strokes[dead];
+    if (!d->defined)
+      continue;
+    define(locale, deads[dead].spacing, 0, HID_KEY_SPACEBAR, d->mod, d->key);
+    const char *composed = deads[dead].composed;
+    for (const char *base = deads[dead].bases; '\0' != *base; base++) {
+      long cp = utf8_decode(&composed);
+      const stroke_t *b = &locale->strokes[(unsigned char) *base];
+      if (b->defined && 0 == b->dead_key)
+        define(locale, cp, b->mod, b->key, d->mod, d->key);
+    }
+  }
+  return true;
+}
+
+static FILE *open_output(const char *dir, const char *name)
+{
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/%s", dir, name);
+  FILE *out = fopen(path, "w");
+  if (NULL == out) {
+    perror(path);
+    exit(1);
+  }
+  return out;
+}
+
+static void upcase(char *dest, const char *src)
+{
+  while ((*dest++ = toupper((unsigned char) *src++)))
+    ;
+}
+
+static void write_utf8(FILE *out, long cp)
+{
+  if (cp < 0x80) {
+    fputc((int) cp, out);
+  } else if (cp < 0x800) {
+    fputc(0xC0 | (int) (cp >> 6), out);
+    fputc(0x80 | (int) (cp & 0x3F), out);
+  } else {
+    fputc(0xE0 | (int) (cp >> 12), out);
+    fputc(0x80 | (int) ((cp >> 6) & 0x3F), out);
+    fputc(0x80 | (int) (cp & 0x3F), out);
+  }
+}
+
+// Designated, so that leaving out the dead key is fine by -Wextra:
+static void write_stroke(FILE *out, const stroke_t *s)
+{
+  fprintf(out, "{ .mod = 0x%02X, .key = %s", s->mod, keymap_symbol_name(s->key));
+  if (0 != s->dead_key)
+    fprintf(out, ", .dead_mod = 0x%02X, .dead_key = %s", s->dead_mod, keymap_symbol_name(s->dead_key));
+  fprintf(out, " }");
+}
+
+static void write_header(FILE *out, unsigned count, const char *sources)
+{
+  char name[KEYMAP_SPEC_NAME_MAX];
+  fprintf(out, "// Generated by host/locale_gen from %s; edit those instead.\n", sources);
+  fprintf(out, "#ifndef _CHORDER_LOCALE_TABLES_H_\n#define _CHORDER_LOCALE_TABLES_H_\n\n");
+  fprintf(out, "// As stored in the \"locale\" NVS setting:\nenum locale {\n");
+  for (unsigned l = 0; l < count; l++) {
+    upcase(name, locales[l].name);
+    fprintf(out, "  LOCALE_%s,\n", name);
+  }
+  fprintf(out, "  LOCALES\n};\n\n#endif\n");
+}
+
+static unsigned count_extras(const layout_t *locale)
+{
+  unsigned extras = 0;
+  for (long cp = 0x80; cp <= MAX_CODEPOINT; cp++)
+    extras += locale->strokes[cp].defined;
+  return extras;
+}
+
+static void write_tables(FILE *out, unsigned count, const char *sources)
+{
+  fprintf(out, "// Generated by host/locale_gen from %s; edit those instead.\n", sources);
+  fprintf(out, "#include \"hid_dev.h\"\n#include \"chorder_locale.h\"\n");
+  for (unsigned l = 0; l < count; l++) {
+    const layout_t *locale = &locales[l];
+    unsigned extras = count_extras(locale);
+    if (0 != extras) {
+      fprintf(out, "\nstatic const locale_extra_t %s_extras[] = {\n", locale->name);
+      for (long cp = 0x80; cp <= MAX_CODEPOINT; cp++) {
+        if (!locale->strokes[cp].defined)
+          continue;
+        fprintf(out, "  { 0x%04lX, ", cp);
+        write_stroke(out, &locale->strokes[cp]);
+        fprintf(out, " },  // ");
+        write_utf8(out, cp);
+        fprintf(out, "\n");
+      }
+      fprintf(out, "};\n");
+    }
+    unsigned ascii = 0;
+    for (int cp = 0; cp < 0x80; cp++)
+      ascii += locale->strokes[cp].defined;
+    printf("%-8s %3u characters, %u of them beyond ASCII\n", locale->name, ascii + extras, extras);
+  }
+
+  fprintf(out, "\nconst locale_table_t locale_tables[LOCALES] = {\n");
+  for (unsigned l = 0; l < count; l++) {
+    const layout_t *locale = &locales[l];
+    fprintf(out, "  {\n    .name = \"%s\",\n    .ascii = {\n", locale->name);
+    for (int cp = 0; cp < 0x80; cp++) {
+      if (!locale->strokes[cp].defined)
+        continue;
+      fprintf(out, "      [0x%02X] = ", cp);
+      write_stroke(out, &locale->strokes[cp]);
+      if (isgraph(cp) && '\\' != cp)
+        fprintf(out, ",  // %c\n", cp);
+      else
+        fprintf(out, ",\n");
+    }
+    fprintf(out, "    },\n");
+    if (0 != count_extras(locale)) {
+      fprintf(out, "    .extras_len = sizeof(%s_extras) / sizeof(%s_extras[0]),\n", locale->name, locale->name);
+      fprintf(out, "    .extras = %s_extras,\n", locale->name);
+    }
+    fprintf(out, "  },\n");
+  }
+  fprintf(out, "};\n");
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 3 || argc - 2 > MAX_LOCALES) {
+    fprintf(stderr, "Usage: %s <output directory> <layout>...\n", argv[0]);
+    return 2;
+  }
+  unsigned count = argc - 2;
+  char sources[1024] = "";
+  for (unsigned l = 0; l < count; l++) {
+    const char *path = argv[2 + l];
+    if (!load_layout(&locales[l], path))
+      return 1;
+    // Only file names go into generated sources, to keep them stable:
+    const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    snprintf(sources + strlen(sources), sizeof(sources) - strlen(sources), "%s%s", l ? ", " : "", name);
+  }
+
+  FILE *out = open_output(argv[1], "chorder_locale_tables.h");
+  write_header(out, count, sources);
+  fclose(out);
+  out = open_output(argv[1], "chorder_locale_tables.c");
+  write_tables(out, count, sources);
+  fclose(out);
+  return 0;
+}
@@ -0,0 +1,6 @@
+// Host stand-in for the (untracked) main/config_private.h:
+#define CHORDER_POST_TARGET "https://localhost/notes"
+#define CHORDER_POST_PARMNAME "note"
+#define CHORDER_POST_SERVER_CERT ""
+#define CHORDER_POST_CLIENT_CERT ""
+#define CHORDER_POST_CLIENT_KEY ""
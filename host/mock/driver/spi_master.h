@@ -0,0 +1,46 @@
+#ifndef _MOCK_DRIVER_SPI_MASTER_H_
+#define _MOCK_DRIVER_SPI_MASTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+#include "esp_err.h"
+
+#define HSPI_HOST 1
+#define SPI_DEVICE_NO_DUMMY (1 << 6)
+#define SPI_MASTER_FREQ_20M (80 * 1000 * 1000 / 4)
+#define SPI_MASTER_FREQ_26M (80 * 1000 * 1000 / 3)
+#define SPI_MASTER_FREQ_40M (80 * 1000 * 1000 / 2)
+#define SPI_MASTER_FREQ_80M (80 * 1000 * 1000 / 1)
+
+typedef struct {
+  int mosi_io_num;
+  int miso_io_num;
+  int sclk_io_num;
+  int quadwp_io_num;
+  int quadhd_io_num;
+} spi_bus_config_t;
+
+typedef struct {
+  int mode;
+  int clock_speed_hz;
+  int spics_io_num;
+  uint32_t flags;
+  int queue_size;
+} spi_device_interface_config_t;
+
+typedef struct {
+  size_t length;
+  const void *tx_buffer;
+  void *rx_buffer;
+} spi_transaction_t;
+
+typedef struct spi_device_t *spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t *bus_config, int dma_chan);
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t *dev_config, spi_device_handle_t *handle);
+// Transactions are counted and discarded; see mock_idf.h:
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc);
+
+#endif
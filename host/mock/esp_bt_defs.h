@@ -0,0 +1,10 @@
+#ifndef _MOCK_ESP_BT_DEFS_H_
+#define _MOCK_ESP_BT_DEFS_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#define ESP_BD_ADDR_LEN 6
+typedef uint8_t esp_bd_addr_t[ESP_BD_ADDR_LEN];
+
+#endif
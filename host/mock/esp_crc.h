@@ -0,0 +1,9 @@
+#ifndef _MOCK_ESP_CRC_H_
+#define _MOCK_ESP_CRC_H_
+
+#include <stdint.h>
+
+// The usual reflected CRC-32 (as in zlib), like the ESP32's ROM routine:
+uint32_t esp_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len);
+
+#endif
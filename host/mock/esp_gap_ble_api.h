@@ -0,0 +1,14 @@
+#include "esp_bt_defs.h"
+
+#ifndef _MOCK_ESP_GAP_BLE_API_H_
+#define _MOCK_ESP_GAP_BLE_API_H_
+
+#include <stdint.h>
+
+typedef struct {
+  uint16_t interval;
+  uint16_t latency;
+  uint16_t timeout;
+} esp_gap_conn_params_t;
+
+#endif
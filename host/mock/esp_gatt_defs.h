@@ -0,0 +1,9 @@
+#ifndef _MOCK_ESP_GATT_DEFS_H_
+#define _MOCK_ESP_GATT_DEFS_H_
+
+#include <stdint.h>
+#include "esp_bt_defs.h"
+
+typedef uint8_t esp_gatt_if_t;
+
+#endif
@@ -0,0 +1 @@
+#include "esp_gatt_defs.h"
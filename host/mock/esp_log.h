@@ -0,0 +1,21 @@
+#ifndef _MOCK_ESP_LOG_H_
+#define _MOCK_ESP_LOG_H_
+
+#include <stdio.h>
+#include "sdkconfig.h"
+
+// Errors, warnings and info go to stderr, so that tools can keep stdout to
+// themselves; debug and verbose output is dropped.
+extern int mock_log_level;
+
+#define MOCK_LOG(level, letter, tag, format, ...) \
+  do { if (mock_log_level >= (level)) fprintf(stderr, letter " (%s) " format "\n", tag, ##__VA_ARGS__); } while (0)
+
+#define ESP_LOGE(tag, format, ...) MOCK_LOG(1, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) MOCK_LOG(2, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) MOCK_LOG(3, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) do { } while (0)
+#define ESP_LOGV(tag, format, ...) do { } while (0)
+#define ESP_LOG_BUFFER_HEX(tag, buffer, len) do { } while (0)
+
+#endif
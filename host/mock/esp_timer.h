@@ -0,0 +1,10 @@
+#ifndef _MOCK_ESP_TIMER_H_
+#define _MOCK_ESP_TIMER_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// Microseconds since start-up; see mock_idf_set_time() to drive it by hand.
+int64_t esp_timer_get_time(void);
+
+#endif
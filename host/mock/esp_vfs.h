@@ -0,0 +1,2 @@
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
@@ -0,0 +1,19 @@
+#ifndef _MOCK_FREERTOS_TASK_H_
+#define _MOCK_FREERTOS_TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+// Ticks follow the mocked esp_timer_get_time():
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
+
+// Task notifications never block; there's only the one (host) thread:
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait);
+void vTaskDelete(TaskHandle_t task);
+
+#endif
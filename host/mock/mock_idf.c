@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "soc/gpio_reg.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_spiffs.h"
+#include "esp_partition.h"
+#include "esp_crc.h"
+#include "nvs_flash.h"
+#include "esp_timer.h"
+
+#include "hid_dev.h"
+#include "chorder_handlers.h"
+#include "chorder_hidtx.h"
+#include "mock_idf.h"
+
+int mock_log_level = 3;
+
+uint32_t mock_hid_report_count = 0;
+mock_hid_report_t mock_hid_last_report;
+void (*mock_hid_report_hook)(const mock_hid_report_t *report) = NULL;
+
+uint32_t mock_spi_transaction_count = 0;
+uint32_t mock_notes_sent = 0;
+uint32_t mock_sleep_requests = 0;
+
+esp_partition_t *mock_partition = NULL;
+const uint8_t *mock_partition_data = NULL;
+uint32_t mock_nvs_writes = 0;
+
+// All keys released; they pull their pins low when pressed:
+volatile uint32_t mock_gpio_in_regs[2] = { 0xffffffff, 0xffffffff };
+
+////////////////////////////////////////////////////////////////////////////////
+// Time
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+static bool time_is_manual = false;
+static int64_t manual_time = 0;
+
+void mock_idf_set_time(int64_t us)
+{
+  time_is_manual = true;
+  manual_time = us;
+}
+
+int64_t esp_timer_get_time(void)
+{
+  if (time_is_manual)
+    return manual_time;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+  return (TickType_t) (esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  // Never actually sleep; a manual clock moves on, though:
+  if (time_is_manual)
+    manual_time += (int64_t) ticks * portTICK_PERIOD_MS * 1000;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+  return (TaskHandle_t) &manual_time;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  (void) task;
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+  (void) clear_on_exit;
+  vTaskDelay(ticks_to_wait == portMAX_DELAY ? 0 : ticks_to_wait);
+  return 0;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  (void) task;
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// HID
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+static void record_report(mock_hid_report_type_t type, const uint8_t *data, size_t len)
+{
+  mock_hid_report_t report = { .type = type, .timestamp = esp_timer_get_time() };
+  memcpy(report.data, data, len);
+  mock_hid_last_report = report;
+  mock_hid_report_count++;
+  if (mock_hid_report_hook)
+    mock_hid_report_hook(&report);
+}
+
+void esp_hidd_send_keyboard_value(uint16_t conn_id, key_mask_t special_key_mask, uint8_t *keyboard_cmd, uint8_t num_key)
+{
+  uint8_t buffer[8] = { special_key_mask, 0 };
+  for (int i = 0; i < num_key && i < 6; i++)
+    buffer[i + 2] = keyboard_cmd[i];
+  record_report(MOCK_HID_KEYBOARD, buffer, sizeof(buffer));
+}
+
+void esp_hidd_send_mouse_value(uint16_t conn_id, uint8_t mouse_button, int8_t mickeys_x, int8_t mickeys_y, int8_t wheel)
+{
+  uint8_t buffer[5] = { mouse_button, (uint8_t) mickeys_x, (uint8_t) mickeys_y, (uint8_t) wheel, 0 };
+  record_report(MOCK_HID_MOUSE, buffer, sizeof(buffer));
+}
+
+void esp_hidd_send_consumer_value(uint16_t conn_id, uint8_t key_cmd, bool key_pressed)
+{
+  uint8_t buffer[2] = { key_pressed ? key_cmd : 0, 0 };
+  record_report(MOCK_HID_CONSUMER, buffer, sizeof(buffer));
+}
+
+// Reports go straight out above, so never wait in a transmit queue:
+hid_tx_stats_t hid_tx_stats;
+
+void hid_tx_dump(void)
+{
+}
+
+// Nor is there a connection to tune:
+void connparams_dump(void)
+{
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Peripherals
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+const char *esp_err_to_name(esp_err_t code)
+{
+  return ESP_OK == code ? "ESP_OK" : "ESP_FAIL";
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode) { return ESP_OK; }
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level) { return ESP_OK; }
+int gpio_get_level(gpio_num_t gpio_num)
+{
+  return (REG_READ(gpio_num < 32 ? GPIO_IN_REG : GPIO_IN1_REG) >> (gpio_num & 31)) & 1;
+}
+void esp_rom_gpio_pad_select_gpio(uint32_t gpio_num) { }
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t *bus_config, int dma_chan) { return ESP_OK; }
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t *dev_config, spi_device_handle_t *handle)
+{
+  *handle = NULL;
+  return ESP_OK;
+}
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc)
+{
+  mock_spi_transaction_count++;
+  return ESP_OK;
+}
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc)
+{
+  return spi_device_transmit(handle, trans_desc);
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label)
+{
+  if (NULL == mock_partition || type != mock_partition->type || subtype != mock_partition->subtype)
+    return NULL;
+  return mock_partition;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+    esp_partition_mmap_memory_t memory, const void **out_ptr, esp_partition_mmap_handle_t *out_handle)
+{
+  if (offset + size > partition->size)
+    return ESP_FAIL;
+  *out_ptr = mock_partition_data + offset;
+  *out_handle = 0;
+  return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) { }
+
+esp_err_t nvs_flash_init_partition(const char *partition_label) { return ESP_OK; }
+esp_err_t nvs_flash_erase_partition(const char *part_name) { return ESP_OK; }
+esp_err_t nvs_open_from_partition(const char *part_name, const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+  *out_handle = 1;
+  return ESP_OK;
+}
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+  return ESP_ERR_NVS_NOT_FOUND;
+}
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+  mock_nvs_writes++;
+  return ESP_OK;
+}
+esp_err_t nvs_commit(nvs_handle_t handle) { return ESP_OK; }
+void nvs_close(nvs_handle_t handle) { }
+
+uint32_t esp_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t *conf) { return ESP_OK; }
+esp_err_t esp_spiffs_info(const char *partition_label, size_t *total_bytes, size_t *used_bytes)
+{
+  *total_bytes = *used_bytes = 0;
+  return ESP_OK;
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// main.c
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+void send_chorder_to_sleep (void)
+{
+  mock_sleep_requests++;
+}
+
+bool send_off_note(char *note)
+{
+  mock_notes_sent++;
+  return true;
+}
+
+// }}}
@@ -0,0 +1,47 @@
+#ifndef _MOCK_IDF_H_
+#define _MOCK_IDF_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_partition.h"
+
+/* Host-side controls and observations for the mocked ESP-IDF layer. */
+
+// Pins esp_timer_get_time() (and thus the tick count) to the given time,
+// instead of following the host's monotonic clock:
+void mock_idf_set_time(int64_t us);
+
+// 0: silent, 1: errors, 2: warnings, 3: info (the default)
+extern int mock_log_level;
+
+typedef enum {
+  MOCK_HID_KEYBOARD,
+  MOCK_HID_MOUSE,
+  MOCK_HID_CONSUMER,
+} mock_hid_report_type_t;
+
+typedef struct {
+  mock_hid_report_type_t type;
+  int64_t timestamp;
+  uint8_t data[8];  // as per the boot protocol keyboard report, or mouse report
+} mock_hid_report_t;
+
+// Every esp_hidd_send_*() call lands here:
+extern uint32_t mock_hid_report_count;
+extern mock_hid_report_t mock_hid_last_report;
+extern void (*mock_hid_report_hook)(const mock_hid_report_t *report);
+
+extern uint32_t mock_spi_transaction_count;
+extern uint32_t mock_notes_sent;
+extern uint32_t mock_sleep_requests;
+
+// The one data partition esp_partition_find_first() knows of, if any, and
+// what esp_partition_mmap() maps it to:
+extern esp_partition_t *mock_partition;
+extern const uint8_t *mock_partition_data;
+
+// Blobs nvs_set_blob() has been asked to write:
+extern uint32_t mock_nvs_writes;
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef _MOCK_NVS_FLASH_H_
+#define _MOCK_NVS_FLASH_H_
+
+#include "nvs.h"
+
+esp_err_t nvs_flash_init_partition(const char *partition_label);
+esp_err_t nvs_flash_erase_partition(const char *part_name);
+
+#endif
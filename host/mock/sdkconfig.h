@@ -0,0 +1,38 @@
+// Host stand-in for the IDF-generated sdkconfig.h; mirrors sdkconfig.defaults
+// and the Kconfig.projbuild defaults.
+#ifndef _MOCK_SDKCONFIG_H_
+#define _MOCK_SDKCONFIG_H_
+
+#define CONFIG_WIDTH 135
+#define CONFIG_HEIGHT 240
+#define CONFIG_OFFSETX 52
+#define CONFIG_OFFSETY 40
+#define CONFIG_MOSI_GPIO 19
+#define CONFIG_SCLK_GPIO 18
+#define CONFIG_CS_GPIO 5
+#define CONFIG_DC_GPIO 16
+#define CONFIG_RESET_GPIO 23
+#define CONFIG_BL_GPIO 4
+
+#define CONFIG_ESP_WIFI_SSID "myssid"
+#define CONFIG_ESP_WIFI_PASSWORD "mypassword"
+#define CONFIG_ESP_MAXIMUM_RETRY 5
+
+#define CONFIG_CHORDER_KEYSCAN_INTERRUPT 1
+#define CONFIG_CHORDER_DEBOUNCE_US 10000
+#define CONFIG_CHORDER_COMMIT_FIRST_RELEASE 1
+#define CONFIG_CHORDER_HID_TX_PER_INTERVAL 2
+#define CONFIG_CHORDER_CONN_PARAMS 1
+#define CONFIG_CHORDER_CONN_IDLE_MS 5000
+#define CONFIG_CHORDER_TAPHOLD 1
+#define CONFIG_CHORDER_HOLD_US 200000
+#define CONFIG_CHORDER_USAGE_STATS 1
+#define CONFIG_CHORDER_USAGE_FLUSH_IDLE_S 30
+#define CONFIG_CHORDER_ADVISOR 1
+#define CONFIG_CHORDER_ADVISOR_WINDOW_MS 500
+#define CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO -1
+#define CONFIG_CHORDER_TYPEMATIC 1
+#define CONFIG_CHORDER_TYPEMATIC_DELAY_MS 500
+#define CONFIG_CHORDER_TYPEMATIC_INTERVAL_MS 40
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef _MOCK_SOC_GPIO_REG_H_
+#define _MOCK_SOC_GPIO_REG_H_
+
+#include <stdint.h>
+
+// The GPIO input registers, as set by a host program:
+extern volatile uint32_t mock_gpio_in_regs[2];
+
+#define GPIO_IN_REG  (&mock_gpio_in_regs[0])
+#define GPIO_IN1_REG (&mock_gpio_in_regs[1])
+#define REG_READ(reg) (*(reg))
+
+#endif
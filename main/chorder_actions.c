@@ -0,0 +1,157 @@
+#include <string.h>
+
+#include "hid_dev.h"
+
+#include "chorder_actions.h"
+#include "chorder_handlers.h"
+#include "chorder_snippets.h"
+
+// A key report sequence, along with its length:
+#define SEQ(...) \
+  .seq = (const action_report_t[]) { __VA_ARGS__ }, \
+  .seq_len = sizeof((const action_report_t[]) { __VA_ARGS__ }) / sizeof(action_report_t)
+#define SHIFTED(key) { 0x02, (key) }
+#define PLAIN(key) { 0x00, (key) }
+
+#define MOD(mask) { .mod_xor = (mask) }
+#define LAYER(op, target) { .layer_op = (op), .layer = (target) }
+#define MACRO(...) { .flags = ACTION_SENDS, SEQ(__VA_ARGS__) }
+#define TEXT(string) { .flags = ACTION_SENDS, .text = (string) }
+#define TEXT_THEN(string, ...) { .flags = ACTION_SENDS, .text = (string), SEQ(__VA_ARGS__) }
+#define CONSUMER(usage) { .flags = ACTION_SENDS, .consumer = (usage) }
+#define SNIPPET(index) { .flags = ACTION_SENDS | ACTION_SNIPPET, .snippet = (index) }
+
+////////////////////////////////////////////////////////////////////////////////
+// Action table
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+#define ACTION(symbol) [(symbol) - DIV_nonkeys_offset]
+
+static const action_t actions[DIV_Last - DIV_nonkeys_offset] = {
+  // Modifier keys toggle for the next key sent:
+  ACTION(MOD_LCTRL)           = MOD(0x01),
+  ACTION(MOD_LSHIFT)          = MOD(0x02),
+  ACTION(MOD_LALT)            = MOD(0x04),
+  ACTION(MOD_LGUI)            = MOD(0x08),
+  ACTION(MOD_RCTRL)           = MOD(0x10),
+  ACTION(MOD_RSHIFT)          = MOD(0x20),
+  ACTION(MOD_RALT)            = MOD(0x40),
+  ACTION(MOD_RGUI)            = MOD(0x80),
+  ACTION(MULTI_CtlAlt)        = MOD(0x01 | 0x04),
+
+  // Layer switching:
+  ACTION(MODE_RESET)          = LAYER(ACTION_LAYER_RESET, KEYMAP_ALPHA),
+  ACTION(MODE_MRESET)         = LAYER(ACTION_LAYER_RESET, KEYMAP_ALPHA),
+  ACTION(MODE_NUM)            = LAYER(ACTION_LAYER_ONESHOT, KEYMAP_NUMSYM),
+  ACTION(MODE_NUMLCK)         = LAYER(ACTION_LAYER_LOCK, KEYMAP_NUMSYM),
+  ACTION(MODE_FUNC)           = LAYER(ACTION_LAYER_ONESHOT, KEYMAP_FUNCTION),
+  ACTION(MODE_FUNCLCK)        = LAYER(ACTION_LAYER_LOCK, KEYMAP_FUNCTION),
+  ACTION(MULTI_NumShift)      = { .mod_xor = 0x02, .layer_op = ACTION_LAYER_ONESHOT, .layer = KEYMAP_NUMSYM },
+
+  // Macros, that type text (in the host's layout) or several keys:
+  ACTION(MACRO_000)           = TEXT("000"),
+  ACTION(MACRO_00)            = TEXT("00"),
+  ACTION(MACRO_quotes)        = TEXT_THEN("\"\"", PLAIN(HID_KEY_LEFT_ARROW)),
+  ACTION(MACRO_parens)        = TEXT_THEN("()", PLAIN(HID_KEY_LEFT_ARROW)),
+  ACTION(MACRO_dollar)        = TEXT("$"),
+  ACTION(MACRO_percent)       = TEXT("%"),
+  ACTION(MACRO_ampersand)     = TEXT("&"),
+  ACTION(MACRO_asterisk)      = TEXT("*"),
+  ACTION(MACRO_question)      = TEXT("?"),
+  ACTION(MACRO_plus)          = TEXT("+"),
+  ACTION(MACRO_openparen)     = TEXT("("),
+  ACTION(MACRO_closeparen)    = TEXT(")"),
+  ACTION(MACRO_opencurly)     = TEXT("{"),
+  ACTION(MACRO_closecurly)    = TEXT("}"),
+
+  // Android specific keys:
+  ACTION(ANDROID_search)      = MACRO({ 0x04, 0x2C }),
+  ACTION(ANDROID_home)        = MACRO({ 0x04, 0x29 }),
+  ACTION(ANDROID_menu)        = MACRO({ 0x10, 0x29 }),
+  ACTION(ANDROID_back)        = MACRO(PLAIN(0x29)),
+  ACTION(ANDROID_dpadcenter)  = MACRO(PLAIN(0x5D)),
+
+  // Media keys, sent as consumer control usages:
+  ACTION(MEDIA_playpause)     = CONSUMER(HID_CONSUMER_PLAY_PAUSE),
+  ACTION(MEDIA_stop)          = CONSUMER(HID_CONSUMER_STOP),
+  ACTION(MEDIA_next)          = CONSUMER(HID_CONSUMER_SCAN_NEXT_TRK),
+  ACTION(MEDIA_previous)      = CONSUMER(HID_CONSUMER_SCAN_PREV_TRK),
+  ACTION(MEDIA_volup)         = CONSUMER(HID_CONSUMER_VOLUME_UP),
+  ACTION(MEDIA_voldn)         = CONSUMER(HID_CONSUMER_VOLUME_DOWN),
+
+  // Snippets, typed out by the snippet task:
+  ACTION(SNIPPET_0)           = SNIPPET(0),
+  ACTION(SNIPPET_1)           = SNIPPET(1),
+  ACTION(SNIPPET_2)           = SNIPPET(2),
+  ACTION(SNIPPET_3)           = SNIPPET(3),
+  ACTION(SNIPPET_4)           = SNIPPET(4),
+  ACTION(SNIPPET_5)           = SNIPPET(5),
+  ACTION(SNIPPET_6)           = SNIPPET(6),
+  ACTION(SNIPPET_7)           = SNIPPET(7),
+};
+
+// Plain HID keys, sent with whatever modifiers are held:
+static const action_t plain_key = { .flags = ACTION_SENDS | ACTION_SEND_SYMBOL };
+static const action_t caps_lock = { .flags = ACTION_CAPS_LOCK };
+static const action_t no_action = { 0 };
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Interpreter
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+const action_t *action_for(symbol_t symbol)
+{
+  if (symbol < DIV_nonkeys_offset)
+    return HID_KEY_CAPS_LOCK == symbol ? &caps_lock : &plain_key;
+  if (symbol >= DIV_Last)
+    return &no_action;
+  return &actions[symbol - DIV_nonkeys_offset];
+}
+
+bool actions_execute(layer_stack_t *layers, symbol_t symbol)
+{
+  const action_t *action = action_for(symbol);
+
+  modKeys ^= action->mod_xor;
+  switch (action->layer_op) {
+    case ACTION_LAYER_NONE:
+      break;
+    case ACTION_LAYER_ONESHOT:
+      layers_oneshot_toggle(layers, action->layer);
+      break;
+    case ACTION_LAYER_TOGGLE:
+      layers_toggle(layers, action->layer);
+      break;
+    case ACTION_LAYER_LOCK:
+      layers_lock_toggle(layers, action->layer);
+      break;
+    case ACTION_LAYER_RESET:
+      layers_reset(layers);
+      modKeys = 0x00;
+      isCapsLocked = false;
+      break;
+  }
+  if (action->flags & ACTION_CAPS_LOCK) {
+    isCapsLocked = !isCapsLocked;
+    modKeys = isCapsLocked ? 0x02 : 0x00;
+  }
+
+  if (action->flags & ACTION_SEND_SYMBOL)
+    sendRawKey(modKeys | heldModKeys, (uint8_t) symbol);
+  if (NULL != action->text)
+    sendText(action->text, strlen(action->text), heldModKeys);
+  for (uint8_t i = 0; i < action->seq_len; i++)
+    sendRawKey(action->seq[i].mod | heldModKeys, action->seq[i].key);
+  if (0 != action->consumer)
+    sendConsumerKey(action->consumer);
+  if (action->flags & ACTION_SNIPPET)
+    snippet_send(action->snippet);
+
+  return action->flags & ACTION_SENDS;
+}
+
+// }}}
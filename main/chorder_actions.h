@@ -0,0 +1,55 @@
+#ifndef _CHORDER_ACTIONS_H_
+#define _CHORDER_ACTIONS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "chordmappings.h"
+#include "chorder_layers.h"
+
+/* What a symbol does in BLE keyboard mode, as data rather than code. Each is
+ * carried out in this order: the modifiers are XORed with mod_xor, the layer
+ * operation is applied, the text is typed, and the key reports and consumer
+ * usage are sent (or the snippet queued). Text goes through the host's layout
+ * (see chorder_locale.h), so macros typing characters should do so as text,
+ * rather than as US key reports. New macros are a row in the action table,
+ * and need no further handling.
+ */
+typedef enum {
+  ACTION_LAYER_NONE,
+  ACTION_LAYER_ONESHOT,    // layers_oneshot_toggle(layer)
+  ACTION_LAYER_TOGGLE,     // layers_toggle(layer)
+  ACTION_LAYER_LOCK,       // layers_lock_toggle(layer)
+  ACTION_LAYER_RESET,      // back to the base layer, with modifiers and caps lock off
+} action_layer_op_t;
+
+// Action flags:
+#define ACTION_SENDS        0x01   // sends keys; one-shot modifiers and layers are used up
+#define ACTION_SEND_SYMBOL  0x02   // sends the symbol itself as a key, with the modifiers held
+#define ACTION_CAPS_LOCK    0x04   // toggles caps lock, i.e. a held left shift
+#define ACTION_SNIPPET      0x08   // queues a snippet for typing out in the background
+
+typedef struct {
+  uint8_t mod;                             // modifier byte, as in the HID report
+  uint8_t key;
+} action_report_t;
+
+typedef struct {
+  uint8_t mod_xor;
+  uint8_t layer_op;                        // action_layer_op_t
+  uint8_t layer;                           // enum keymap_layer
+  uint8_t flags;
+  uint8_t consumer;                        // HID_CONSUMER_* usage, or 0 for none
+  uint8_t snippet;                         // index into snippet_texts
+  const char *text;                        // UTF-8 text to type, or NULL
+  uint8_t seq_len;
+  const action_report_t *seq;              // key reports to send, each pressed and released
+} action_t;
+
+// The action for any symbol; symbols without one get an action doing nothing:
+const action_t *action_for(symbol_t symbol);
+
+// Carries out symbol's action on layers; true if it sent any keys:
+bool actions_execute(layer_stack_t *layers, symbol_t symbol);
+
+#endif
@@ -0,0 +1,23 @@
+#include "esp_log.h"
+
+#include "chorder_advisor.h"
+
+advisor_t advisor;
+
+void advisor_init(advisor_t *a, int32_t window_us)
+{
+  a->window_us = window_us;
+  a->previous = 0;
+  a->previous_at = 0;
+  a->released_all = false;
+  a->judged = 0;
+  a->wasteful = 0;
+}
+
+void advisor_dump(const advisor_t *a)
+{
+  if (0 == a->judged)
+    return;
+  ESP_LOGI(__FUNCTION__, "transitions: %u judged, %u typed from scratch that could have held keys over (%.1f%%)",
+      (unsigned) a->judged, (unsigned) a->wasteful, a->judged ? 100.0 * a->wasteful / a->judged : 0.0);
+}
@@ -0,0 +1,55 @@
+#ifndef _CHORDER_ADVISOR_H_
+#define _CHORDER_ADVISOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "chorder_keymap.h"
+
+/* Transition advisor: notices chords typed from scratch, with every key let
+ * go of since the chord before, that would have been less effort typed by
+ * holding over keys the two share; e.g. letting go of all of an A (C+IMR)
+ * before an E (IMR), rather than just C, then I again.
+ *
+ * Which transitions those are is precomputed by host/keymap_gen into
+ * keymap_holdover, so judging a chord is a bit test. Transitions slower than
+ * the window are left alone, as there's no hurry to hold anything over then.
+ */
+typedef struct {
+  int32_t window_us;
+  uint8_t previous;                        // the last chord committed, or 0
+  int64_t previous_at;
+  bool released_all;                       // whether every key's been up since
+  uint32_t judged;                         // transitions within the window
+  uint32_t wasteful;                       // ... typed from scratch needlessly
+} advisor_t;
+
+extern advisor_t advisor;
+
+void advisor_init(advisor_t *a, int32_t window_us);
+
+// Feeds every keyState after the chord (if any) it commits:
+static inline void advisor_keys(advisor_t *a, uint8_t keyState)
+{
+  a->released_all |= 0 == keyState;
+}
+
+/* Judges a chord committed at now: returns the keys it shares with the chord
+ * before, if those should have been held over, and 0 otherwise.
+ */
+static inline uint8_t advisor_commit(advisor_t *a, uint8_t chord, int64_t now)
+{
+  uint8_t previous = a->previous;
+  bool judged = 0 != previous && now - a->previous_at < a->window_us;
+  bool wasteful = judged && a->released_all && (keymap_holdover[previous][chord / 8] & (1 << (chord % 8)));
+  a->judged += judged;
+  a->wasteful += wasteful;
+  a->previous = chord;
+  a->previous_at = now;
+  a->released_all = false;
+  return wasteful ? previous & chord : 0;
+}
+
+void advisor_dump(const advisor_t *a);
+
+#endif
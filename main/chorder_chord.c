@@ -0,0 +1,95 @@
+#include "esp_log.h"
+
+#include "chorder_chord.h"
+
+void chord_machine_init(chord_machine_t *cm, chord_commit_policy_t policy, int32_t rollover_us)
+{
+  cm->policy = policy;
+  cm->rollover_us = rollover_us;
+  cm->state = RELEASING;
+  cm->previous = 0;
+  cm->stale = 0;
+  cm->chord_start = 0;
+  cm->speculate_us = 0;
+  cm->last_change = 0;
+  cm->speculated = false;
+}
+
+void chord_machine_set_speculation(chord_machine_t *cm, int32_t speculate_us)
+{
+  cm->speculate_us = speculate_us;
+}
+
+int64_t chord_machine_speculation_deadline(const chord_machine_t *cm)
+{
+  if (0 == cm->speculate_us || PRESSING != cm->state || cm->speculated)
+    return -1;
+  return cm->last_change + cm->speculate_us;
+}
+
+uint8_t chord_machine_speculate(chord_machine_t *cm, int64_t now)
+{
+  int64_t deadline = chord_machine_speculation_deadline(cm);
+  if (-1 == deadline || now < deadline)
+    return 0;
+  cm->speculated = true;
+  if (now - cm->chord_start >= cm->rollover_us)
+    return cm->previous;
+  return cm->previous & ~cm->stale;
+}
+
+uint8_t chord_machine_feed(chord_machine_t *cm, uint8_t keyState, int64_t now)
+{
+  uint8_t chord = 0;
+
+  if (cm->previous == keyState)
+    return 0;
+
+  ESP_LOGD(__FUNCTION__, "New reading: %s%s%s %s%s%s%s",
+      keyState & (1 << 6) ? "F" : "_",
+      keyState & (1 << 5) ? "C" : "_",
+      keyState & (1 << 4) ? "N" : "_",
+      keyState & (1 << 3) ? "I" : "_",
+      keyState & (1 << 2) ? "M" : "_",
+      keyState & (1 << 1) ? "R" : "_",
+      keyState & (1 << 0) ? "P" : "_"
+  );
+  uint8_t released = cm->previous & ~keyState;
+
+  // Stale keys still held once the rollover window has passed are taken to
+  // be part of the new chord:
+  if (PRESSING == cm->state && now - cm->chord_start >= cm->rollover_us)
+    cm->stale = 0;
+
+  switch (cm->state) {
+    case PRESSING:
+      // Stale keys still in the rollover window belong to the last chord:
+      if (released & ~cm->stale) {
+        cm->state = RELEASING;
+        chord = cm->previous & ~cm->stale;
+      }
+      break;
+
+    case RELEASING:
+      if (keyState & ~cm->previous) {
+        cm->state = PRESSING;
+        cm->chord_start = now;
+      }
+      break;
+  }
+  if (CHORD_COMMIT_ROLLOVER == cm->policy)
+    cm->stale = (0 != chord ? keyState : cm->stale) & keyState;
+  cm->previous = keyState;
+  cm->last_change = now;
+  cm->speculated = false;
+  return chord;
+}
+
+void chord_machine_restart(chord_machine_t *cm, uint8_t keyState, int64_t now)
+{
+  cm->state = RELEASING;
+  cm->previous = keyState;
+  cm->stale = 0;
+  cm->last_change = now;
+  cm->speculated = true;
+}
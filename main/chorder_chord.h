@@ -0,0 +1,65 @@
+#ifndef _CHORDER_CHORD_H_
+#define _CHORDER_CHORD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum State {
+  PRESSING,
+  RELEASING,
+};
+
+typedef enum {
+  // The first key to come back up commits everything held up to that point,
+  // and nothing more is committed until a key goes down again:
+  CHORD_COMMIT_FIRST_RELEASE,
+  // As above, but keys still held from the last chord ("stale" keys) may be
+  // let go of while the next chord is forming without committing anything,
+  // provided that happens within the rollover window of the next chord's
+  // first press. Stale keys held beyond that become part of the next chord.
+  CHORD_COMMIT_ROLLOVER,
+} chord_commit_policy_t;
+
+/* Turns a stream of debounced keyStates into chords, as per a commit policy.
+ *
+ * Under either policy, holding some keys of a chord and re-pressing others
+ * makes another chord of everything then held; e.g. going from an A (C+IMR)
+ * to an E (IMR) by releasing C, then releasing and re-pressing I. Rollover
+ * additionally lets the next chord start before the last one is fully
+ * released, as long as the overlap is brief.
+ */
+typedef struct {
+  chord_commit_policy_t policy;
+  int32_t rollover_us;
+  enum State state;
+  uint8_t previous;                        // the last keyState fed
+  uint8_t stale;                           // keys held over from the last chord
+  int64_t chord_start;                     // first press of the forming chord
+  int32_t speculate_us;                    // 0 to never speculate
+  int64_t last_change;                     // when the last keyState was fed
+  bool speculated;                         // whether it's been speculated on
+} chord_machine_t;
+
+void chord_machine_init(chord_machine_t *cm, chord_commit_policy_t policy, int32_t rollover_us);
+
+/* Speculation: a chord that's been held unchanged for speculate_us is likely
+ * the one about to be committed, so its output may be sent ahead of time.
+ */
+void chord_machine_set_speculation(chord_machine_t *cm, int32_t speculate_us);
+// When the forming chord will be up for speculation, or -1 if it won't be:
+int64_t chord_machine_speculation_deadline(const chord_machine_t *cm);
+// The chord to speculate on at now, at most once per keyState; 0 if none:
+uint8_t chord_machine_speculate(chord_machine_t *cm, int64_t now);
+
+/* Feeds the next debounced keyState, changed at now (in microseconds), and
+ * returns the chord it commits, or 0 if it doesn't commit one:
+ */
+uint8_t chord_machine_feed(chord_machine_t *cm, uint8_t keyState, int64_t now);
+
+/* Drops the chord being formed, without committing it, as if keyState had
+ * been what was left after a commit; e.g. once its keys turn out to be held
+ * for a tap-hold chord's hold role instead:
+ */
+void chord_machine_restart(chord_machine_t *cm, uint8_t keyState, int64_t now);
+
+#endif
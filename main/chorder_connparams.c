@@ -0,0 +1,190 @@
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_gap_ble_api.h"
+#include "sdkconfig.h"
+
+#include "chorder_handlers.h"
+#include "chorder_connparams.h"
+
+static const char *profile_names[CONN_PROFILES] = {
+  [CONN_PROFILE_DISCONNECTED] = "disconnected",
+  [CONN_PROFILE_HOST]         = "host's",
+  [CONN_PROFILE_TYPING]       = "typing",
+  [CONN_PROFILE_IDLE]         = "idle",
+};
+
+// Written from the BLE callbacks and the decoder both:
+static portMUX_TYPE connparams_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t waker = NULL;
+static esp_bd_addr_t peer;
+static bool connected = false;
+static int64_t last_activity = 0;
+static uint8_t requested = CONN_PROFILE_HOST;   // last asked for
+static bool pending = false;                    // asked for, not yet answered
+static esp_gap_conn_params_t current;
+static uint8_t profile = CONN_PROFILE_DISCONNECTED;
+static int64_t profile_since = 0;
+static int64_t time_in[CONN_PROFILES];
+static uint32_t requests = 0, rejections = 0;
+
+// Which profile parameters fall in, whoever asked for them:
+static uint8_t profile_of(const esp_gap_conn_params_t *params)
+{
+  if (params->interval <= CONN_TYPING_MAX_INTERVAL && 0 == params->latency)
+    return CONN_PROFILE_TYPING;
+  if (params->interval >= CONN_IDLE_MIN_INTERVAL && 0 != params->latency)
+    return CONN_PROFILE_IDLE;
+  return CONN_PROFILE_HOST;
+}
+
+// With connparams_lock held:
+static void enter_profile(uint8_t to, int64_t now)
+{
+  time_in[profile] += now - profile_since;
+  profile = to;
+  profile_since = now;
+}
+
+static void request(uint8_t to)
+{
+  esp_ble_conn_update_params_t params = {
+    .min_int = CONN_PROFILE_TYPING == to ? CONN_TYPING_MIN_INTERVAL : CONN_IDLE_MIN_INTERVAL,
+    .max_int = CONN_PROFILE_TYPING == to ? CONN_TYPING_MAX_INTERVAL : CONN_IDLE_MAX_INTERVAL,
+    .latency = CONN_PROFILE_TYPING == to ? CONN_TYPING_LATENCY : CONN_IDLE_LATENCY,
+    .timeout = CONN_PROFILE_TYPING == to ? CONN_TYPING_TIMEOUT : CONN_IDLE_TIMEOUT,
+  };
+  memcpy(params.bda, peer, sizeof(esp_bd_addr_t));
+  ESP_LOGD(__FUNCTION__, "Asking for the %s profile", profile_names[to]);
+  if (ESP_OK != esp_ble_gap_update_conn_params(&params)) {
+    ESP_LOGW(__FUNCTION__, "Cannot ask for the %s profile", profile_names[to]);
+    portENTER_CRITICAL(&connparams_lock);
+    pending = false;
+    portEXIT_CRITICAL(&connparams_lock);
+  }
+}
+
+void connparams_init(TaskHandle_t to_wake)
+{
+  waker = to_wake;
+}
+
+void connparams_connected(const esp_bd_addr_t bda, const esp_gap_conn_params_t *params)
+{
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&connparams_lock);
+  memcpy(peer, bda, sizeof(esp_bd_addr_t));
+  connected = true;
+  last_activity = now;
+  requested = CONN_PROFILE_HOST;
+  pending = false;
+  current = *params;
+  enter_profile(profile_of(params), now);
+  portEXIT_CRITICAL(&connparams_lock);
+  if (NULL != waker)
+    xTaskNotifyGive(waker);
+}
+
+void connparams_disconnected(void)
+{
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&connparams_lock);
+  connected = false;
+  pending = false;
+  enter_profile(CONN_PROFILE_DISCONNECTED, now);
+  portEXIT_CRITICAL(&connparams_lock);
+}
+
+void connparams_updated(bool accepted, const esp_gap_conn_params_t *params)
+{
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&connparams_lock);
+  bool answer = pending;
+  uint8_t asked = requested, from = profile, to = profile_of(params);
+  pending = false;
+  if (accepted) {
+    current = *params;
+    enter_profile(to, now);
+  } else if (answer) {
+    rejections++;
+  }
+  portEXIT_CRITICAL(&connparams_lock);
+
+  if (accepted) {
+    ESP_LOGI(__FUNCTION__, "Connection interval %u us, latency %u, timeout %u ms: %s profile, was %s",
+        (unsigned) params->interval * 1250, (unsigned) params->latency, (unsigned) params->timeout * 10,
+        profile_names[to], profile_names[from]);
+  } else if (answer) {
+    ESP_LOGW(__FUNCTION__, "Host turned down the %s profile", profile_names[asked]);
+  }
+  // The idle profile may be due meanwhile:
+  if (NULL != waker)
+    xTaskNotifyGive(waker);
+}
+
+void connparams_activity(int64_t now)
+{
+  bool ask = false;
+  portENTER_CRITICAL(&connparams_lock);
+  last_activity = now;
+  if (connected && sec_conn && !pending && CONN_PROFILE_TYPING != requested) {
+    requested = CONN_PROFILE_TYPING;
+    pending = true;
+    requests++;
+    ask = true;
+  }
+  portEXIT_CRITICAL(&connparams_lock);
+  if (ask)
+    request(CONN_PROFILE_TYPING);
+}
+
+void connparams_poll(int64_t now)
+{
+  bool ask = false;
+  portENTER_CRITICAL(&connparams_lock);
+  if (connected && sec_conn && !pending && CONN_PROFILE_IDLE != requested
+      && now - last_activity >= (int64_t) CONFIG_CHORDER_CONN_IDLE_MS * 1000) {
+    requested = CONN_PROFILE_IDLE;
+    pending = true;
+    requests++;
+    ask = true;
+  }
+  portEXIT_CRITICAL(&connparams_lock);
+  if (ask)
+    request(CONN_PROFILE_IDLE);
+}
+
+int64_t connparams_deadline(void)
+{
+  int64_t deadline = -1;
+  portENTER_CRITICAL(&connparams_lock);
+  // Not while waiting on an answer, which wakes the decoder again:
+  if (connected && sec_conn && !pending && CONN_PROFILE_IDLE != requested)
+    deadline = last_activity + (int64_t) CONFIG_CHORDER_CONN_IDLE_MS * 1000;
+  portEXIT_CRITICAL(&connparams_lock);
+  return deadline;
+}
+
+void connparams_dump(void)
+{
+  int64_t now = esp_timer_get_time();
+  int64_t totals[CONN_PROFILES];
+  portENTER_CRITICAL(&connparams_lock);
+  memcpy(totals, time_in, sizeof(totals));
+  totals[profile] += now - profile_since;
+  portEXIT_CRITICAL(&connparams_lock);
+
+  int64_t all = 0;
+  for (uint8_t p = 0; p < CONN_PROFILES; p++)
+    all += totals[p];
+  for (uint8_t p = 0; p < CONN_PROFILES; p++) {
+    ESP_LOGI(__FUNCTION__, "%-12s %8u s %5.1f%%", profile_names[p], (unsigned) (totals[p] / 1000000),
+        all > 0 ? 100.0 * totals[p] / all : 0.0);
+  }
+  ESP_LOGI(__FUNCTION__, "Now at interval %u us, latency %u, timeout %u ms; %u profiles asked for, %u turned down",
+      (unsigned) current.interval * 1250, (unsigned) current.latency, (unsigned) current.timeout * 10,
+      (unsigned) requests, (unsigned) rejections);
+}
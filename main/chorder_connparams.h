@@ -0,0 +1,61 @@
+#ifndef _CHORDER_CONNPARAMS_H_
+#define _CHORDER_CONNPARAMS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_gap_ble_api.h"
+
+/* Connection parameters to suit what the keyboard's doing. While chords are
+ * coming in, the shortest interval there is, 7.5 ms, with no slave latency,
+ * so a report waits at most that long for the radio. Once nothing's been typed
+ * for CONFIG_CHORDER_CONN_IDLE_MS, a long interval with high slave latency,
+ * so the radio's mostly off; the first chord after that still goes out at
+ * the next connection event, and asks for the short interval again.
+ *
+ * Each profile is asked for once per change; a host turning one down is left
+ * be until the other's called for. Whatever's in effect, asked for or not, is
+ * followed from the GAP events, and time is counted against the profile it
+ * falls in.
+ */
+enum conn_profile {
+  CONN_PROFILE_DISCONNECTED,
+  CONN_PROFILE_HOST,                       // parameters of the host's own choosing
+  CONN_PROFILE_TYPING,
+  CONN_PROFILE_IDLE,
+  CONN_PROFILES,
+};
+
+// In the units BLE has them in: 1.25 ms for intervals, 10 ms for timeouts.
+// Up to 11.25 ms for hosts that won't go as low as 7.5:
+#define CONN_TYPING_MIN_INTERVAL   6
+#define CONN_TYPING_MAX_INTERVAL   9
+#define CONN_TYPING_LATENCY        0
+#define CONN_TYPING_TIMEOUT        200
+// Listening every 600 ms or so, well inside the supervision timeout:
+#define CONN_IDLE_MIN_INTERVAL     80
+#define CONN_IDLE_MAX_INTERVAL     96
+#define CONN_IDLE_LATENCY          4
+#define CONN_IDLE_TIMEOUT          600
+
+// The task to wake, by notification, when there may be a profile to ask
+// for; the decoder, which calls connparams_poll():
+void connparams_init(TaskHandle_t to_wake);
+
+// From the BLE callbacks:
+void connparams_connected(const esp_bd_addr_t bda, const esp_gap_conn_params_t *params);
+void connparams_disconnected(void);
+void connparams_updated(bool accepted, const esp_gap_conn_params_t *params);
+
+// A key event, at the given time; asks for the typing profile, if need be:
+void connparams_activity(int64_t now);
+// Asks for the idle profile once it's due:
+void connparams_poll(int64_t now);
+// When the idle profile's next due, or -1 if it isn't:
+int64_t connparams_deadline(void);
+
+void connparams_dump(void);
+
+#endif
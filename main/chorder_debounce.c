@@ -0,0 +1,58 @@
+#include <string.h>
+#include "chorder_debounce.h"
+
+void debounce_init(debouncer_t *db, const int32_t window_us[DEBOUNCE_KEYS])
+{
+  memset(db, 0, sizeof(debouncer_t));
+  memcpy(db->window_us, window_us, sizeof(db->window_us));
+}
+
+uint8_t debounce_update(debouncer_t *db, uint8_t raw, const int64_t *edge_times, int64_t now)
+{
+  uint8_t changed = db->raw ^ raw;
+
+  for (int key = 0; key < DEBOUNCE_KEYS; key++) {
+    uint8_t bit = 1 << key;
+
+    // An edge the interrupt handler timestamped is when the change really
+    // happened; the reading only shows it later:
+    if (edge_times && edge_times[key] > db->last_activity[key])
+      db->last_activity[key] = edge_times[key];
+    else if (changed & bit)
+      db->last_activity[key] = now;
+
+    if (raw & bit) {
+      // Eager press: the first reading with the key down counts.
+      db->stable |= bit;
+    } else if ((db->stable & bit) && now - db->last_activity[key] >= db->window_us[key]) {
+      db->stable &= ~bit;
+    }
+  }
+  db->raw = raw;
+  return db->stable;
+}
+
+int64_t debounce_next_deadline(const debouncer_t *db)
+{
+  int64_t deadline = -1;
+  uint8_t releasing = db->stable & ~db->raw;
+
+  for (int key = 0; key < DEBOUNCE_KEYS; key++) {
+    if (!(releasing & (1 << key)))
+      continue;
+    int64_t settles_at = db->last_activity[key] + db->window_us[key];
+    if (-1 == deadline || settles_at < deadline)
+      deadline = settles_at;
+  }
+  return deadline;
+}
+
+int64_t debounce_last_activity(const debouncer_t *db, uint8_t mask)
+{
+  int64_t latest = 0;
+  for (int key = 0; key < DEBOUNCE_KEYS; key++) {
+    if ((mask & (1 << key)) && db->last_activity[key] > latest)
+      latest = db->last_activity[key];
+  }
+  return latest;
+}
@@ -0,0 +1,42 @@
+#ifndef _CHORDER_DEBOUNCE_H_
+#define _CHORDER_DEBOUNCE_H_
+
+#include <stdint.h>
+
+#define DEBOUNCE_KEYS 7
+
+/* Per-key debouncing of raw keyStates.
+ *
+ * Presses are asymmetric to releases: a key is taken as pressed on the first
+ * reading that has it down, since a chord isn't acted upon until keys come
+ * back up anyway. Releases are only accepted once the key has read as up,
+ * without any further edges, for that key's debounce window. Bouncing on one
+ * key thus never holds up any other key.
+ */
+typedef struct {
+  uint8_t stable;                          // the debounced keyState
+  uint8_t raw;                             // the last raw keyState seen
+  int32_t window_us[DEBOUNCE_KEYS];        // release debounce window per key
+  int64_t last_activity[DEBOUNCE_KEYS];    // last change or edge, per key
+} debouncer_t;
+
+void debounce_init(debouncer_t *db, const int32_t window_us[DEBOUNCE_KEYS]);
+
+/* Feeds a raw keyState sampled at now (in microseconds) and returns the
+ * debounced keyState. edge_times may give the last edge timestamp per key (as
+ * seen by an interrupt handler), so that changes are dated by their edge
+ * rather than by the reading, and bounces between two samples still restart a
+ * key's window; pass NULL when polling.
+ */
+uint8_t debounce_update(debouncer_t *db, uint8_t raw, const int64_t *edge_times, int64_t now);
+
+/* The time at which a pending release will have settled and the next
+ * debounce_update() could change the debounced keyState without a new
+ * reading, or -1 if nothing is pending:
+ */
+int64_t debounce_next_deadline(const debouncer_t *db);
+
+// The most recent change or edge seen on any of the keys in mask:
+int64_t debounce_last_activity(const debouncer_t *db, uint8_t mask);
+
+#endif
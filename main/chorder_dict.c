@@ -0,0 +1,206 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_crc.h"
+
+#include "chorder_dict.h"
+#include "chorder_locale.h"
+
+dictionary_t dictionary;
+
+////////////////////////////////////////////////////////////////////////////////
+// Lookup
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+// FNV-1a; outlines are short, so there's little to be had from anything wider.
+// Its low bits only depend on the strokes' low bits, so it's finished off
+// with a mix, for those to make a fingerprint:
+uint32_t dict_hash(const uint8_t *strokes, uint8_t nstrokes)
+{
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < nstrokes; i++) {
+    hash ^= strokes[i];
+    hash *= 16777619UL;
+  }
+  hash ^= hash >> 16;
+  hash *= 0x85EBCA6BUL;
+  hash ^= hash >> 13;
+  return hash;
+}
+
+// Whether record is that of the outline:
+static bool record_is(const uint8_t *record, const uint8_t *strokes, uint8_t nstrokes)
+{
+  // A shorter record's last stroke never matches, so this stops within it:
+  for (uint8_t i = 0; i + 1 < nstrokes; i++) {
+    if (record[i] != strokes[i])
+      return false;
+  }
+  return record[nstrokes - 1] == (strokes[nstrokes - 1] | DICT_LAST_STROKE);
+}
+
+bool dict_attach(dictionary_t *d, const void *blob, size_t size)
+{
+  const dict_blob_header_t *header = blob;
+  if (size < sizeof(*header) || DICT_BLOB_MAGIC != header->magic) {
+    ESP_LOGI(__FUNCTION__, "Dictionary partition is empty; chords only");
+    return false;
+  }
+  if (DICT_BLOB_VERSION != header->version) {
+    ESP_LOGE(__FUNCTION__, "Dictionary blob is version %u, not %u; chords only",
+        header->version, DICT_BLOB_VERSION);
+    return false;
+  }
+  size_t tables_size = (size_t) header->buckets * sizeof(uint32_t) + header->records_size;
+  if (0 == header->max_strokes || header->max_strokes > DICT_MAX_STROKES
+      || header->entries >= header->buckets || header->records_size > DICT_RECORDS_MAX) {
+    ESP_LOGE(__FUNCTION__, "Dictionary blob is malformed; chords only");
+    return false;
+  }
+  if (sizeof(*header) + tables_size > size) {
+    ESP_LOGE(__FUNCTION__, "Dictionary blob (%u bytes) doesn't fit its partition (%u bytes); chords only",
+        (unsigned) (sizeof(*header) + tables_size), (unsigned) size);
+    return false;
+  }
+  if (header->crc32 != esp_crc32_le(0, (const uint8_t *) (header + 1), tables_size)) {
+    ESP_LOGE(__FUNCTION__, "Dictionary blob fails its CRC; chords only");
+    return false;
+  }
+
+  d->header = header;
+  d->buckets = (const uint32_t *) (header + 1);
+  d->records = (const uint8_t *) (d->buckets + header->buckets);
+  dict_forget(d);
+  ESP_LOGI(__FUNCTION__, "Using a dictionary of %u outlines, up to %u strokes long",
+      (unsigned) header->entries, header->max_strokes);
+  return true;
+}
+
+void dict_partition_load(dictionary_t *d)
+{
+  const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, DICT_PARTITION_SUBTYPE, NULL);
+  if (NULL == partition) {
+    ESP_LOGI(__FUNCTION__, "No dictionary partition; chords only");
+    return;
+  }
+
+  // As with the keymap, the mapping is kept for good, to look up in place:
+  const void *mapped;
+  esp_partition_mmap_handle_t handle;
+  esp_err_t ret = esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &mapped, &handle);
+  if (ESP_OK != ret) {
+    ESP_LOGE(__FUNCTION__, "Cannot map the dictionary partition (%s); chords only", esp_err_to_name(ret));
+    return;
+  }
+  if (!dict_attach(d, mapped, partition->size))
+    esp_partition_munmap(handle);
+}
+
+bool dict_lookup(dictionary_t *d, const uint8_t *strokes, uint8_t nstrokes, const char **text, uint8_t *text_len)
+{
+  uint32_t hash = dict_hash(strokes, nstrokes);
+  uint32_t nbuckets = d->header->buckets;
+  uint32_t fingerprint = hash & 0xFF;
+  d->stats.lookups++;
+
+  // There are more buckets than entries, so always an empty one to stop at:
+  for (uint32_t i = dict_home(hash, nbuckets); ; i = i + 1 == nbuckets ? 0 : i + 1) {
+    uint32_t bucket = d->buckets[i];
+    d->stats.probes++;
+    if (DICT_BUCKET_EMPTY == bucket)
+      return false;
+    if (bucket >> 24 != fingerprint)
+      continue;
+    const uint8_t *record = d->records + (bucket & DICT_RECORDS_MAX);
+    if (record_is(record, strokes, nstrokes)) {
+      *text_len = record[nstrokes];
+      *text = (const char *) record + 1 + nstrokes;
+      return true;
+    }
+  }
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Translation
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+void dict_forget(dictionary_t *d)
+{
+  d->history_len = 0;
+}
+
+static void push_translation(dictionary_t *d, const uint8_t *strokes, uint8_t nstrokes, uint8_t output_len)
+{
+  if (DICT_HISTORY == d->history_len) {
+    memmove(&d->history[0], &d->history[1], (DICT_HISTORY - 1) * sizeof(d->history[0]));
+    d->history_len--;
+  }
+  dict_translation_t *t = &d->history[d->history_len++];
+  memcpy(t->strokes, strokes, nstrokes);
+  t->nstrokes = nstrokes;
+  t->output_len = output_len;
+}
+
+bool dict_stroke(dictionary_t *d, uint8_t stroke, uint8_t fallback_len, dict_output_t *out)
+{
+  if (NULL == d->header)
+    return false;
+  d->stats.strokes++;
+
+  // Strokes in the latest k translations, for each k:
+  uint8_t strokes_back[DICT_HISTORY + 1] = { 0 };
+  for (uint8_t k = 1; k <= d->history_len; k++)
+    strokes_back[k] = strokes_back[k - 1] + d->history[d->history_len - k].nstrokes;
+
+  uint8_t outline[DICT_MAX_STROKES];
+  for (int k = d->history_len; k >= 0; k--) {
+    uint8_t nstrokes = strokes_back[k] + 1;
+    if (nstrokes > d->header->max_strokes)
+      continue;
+    uint8_t pos = 0;
+    for (uint8_t i = d->history_len - k; i < d->history_len; i++) {
+      memcpy(outline + pos, d->history[i].strokes, d->history[i].nstrokes);
+      pos += d->history[i].nstrokes;
+    }
+    outline[pos] = stroke;
+
+    const char *text;
+    uint8_t text_len;
+    if (!dict_lookup(d, outline, nstrokes, &text, &text_len))
+      continue;
+
+    out->backspaces = 0;
+    for (uint8_t i = d->history_len - k; i < d->history_len; i++)
+      out->backspaces += d->history[i].output_len;
+    out->text = text;
+    out->text_len = text_len;
+    d->history_len -= k;
+    // Backspaces take back characters, not UTF-8 bytes:
+    push_translation(d, outline, nstrokes, locale_utf8_length(text, text_len));
+    d->stats.translations++;
+    if (k > 0)
+      d->stats.corrections++;
+    return true;
+  }
+
+  if (0 == fallback_len)
+    dict_forget(d);
+  else
+    push_translation(d, &stroke, 1, fallback_len);
+  return false;
+}
+
+void dict_dump(const dictionary_t *d)
+{
+  if (NULL == d->header)
+    return;
+  ESP_LOGI(__FUNCTION__, "dictionary: %u strokes, %u translated (%u extending earlier ones), %u lookups, %.2f probes/lookup",
+      (unsigned) d->stats.strokes, (unsigned) d->stats.translations, (unsigned) d->stats.corrections,
+      (unsigned) d->stats.lookups, d->stats.lookups ? (double) d->stats.probes / d->stats.lookups : 0.0);
+}
+
+// }}}
@@ -0,0 +1,115 @@
+#ifndef _CHORDER_DICT_H_
+#define _CHORDER_DICT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Steno-style dictionary of outlines, i.e. sequences of chords (strokes),
+ * translating to words, for more whole-word chords than fit in a keymap
+ * layer. Dictionaries are packed by host/dict_pack into the "dict" data
+ * partition and looked up in place.
+ *
+ * A dictionary blob is this header, followed by an open-addressed (linear
+ * probing) hash table of uint32_t buckets, followed by the records they
+ * point at. The table needn't be a power of two in size: probing starts at
+ * dict_home(), which scales the hash to it, so it's kept three quarters full
+ * rather than anywhere down to three eighths. A bucket holds the low 8 bits
+ * of its outline's hash above a 24 bit record offset, or DICT_BUCKET_EMPTY.
+ * A record is the strokes, the last with DICT_LAST_STROKE set (chords being
+ * 7 bits), the text length and the text (not NUL-terminated). Everything is
+ * little-endian; the CRC covers the buckets and records.
+ *
+ * An outline costs 4 / 0.75 bytes of buckets, plus its strokes, plus its
+ * text and a byte: about 17 bytes for two strokes typing eight letters and a
+ * space. The dict partition of partitions_example.csv (1,748,992 bytes)
+ * holds 100k of those.
+ */
+#define DICT_PARTITION_SUBTYPE  0x41
+#define DICT_BLOB_MAGIC         0x54434944UL   // "DICT"
+#define DICT_BLOB_VERSION       2
+#define DICT_BUCKET_EMPTY       0xFFFFFFFFUL
+#define DICT_RECORDS_MAX        0x00FFFFFFUL
+#define DICT_LAST_STROKE        0x80
+
+// Longest outline there may be, and how many translations back are looked at
+// for one to be extended:
+#define DICT_MAX_STROKES 8
+#define DICT_HISTORY     8
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t max_strokes;                     // longest outline in this dictionary
+  uint8_t reserved;
+  uint32_t buckets;                        // more than entries
+  uint32_t entries;
+  uint32_t records_size;
+  uint32_t crc32;                          // esp_crc32_le(0, buckets and records, ...)
+} dict_blob_header_t;
+
+// What a stroke's translation puts out, strokes it took back and all:
+typedef struct {
+  uint16_t backspaces;                     // characters to take back first
+  uint8_t text_len;
+  const char *text;
+} dict_output_t;
+
+typedef struct {
+  uint8_t strokes[DICT_MAX_STROKES];
+  uint8_t nstrokes;
+  uint8_t output_len;                      // characters put out, for taking back
+} dict_translation_t;
+
+typedef struct {
+  uint32_t strokes;                        // strokes looked up
+  uint32_t lookups;                        // outlines looked up for them
+  uint32_t probes;                         // buckets looked at for those
+  uint32_t translations;                   // strokes translated
+  uint32_t corrections;                    // ... by extending earlier translations
+} dict_stats_t;
+
+typedef struct {
+  const dict_blob_header_t *header;        // NULL without a dictionary
+  const uint32_t *buckets;
+  const uint8_t *records;
+  // The latest translations, oldest first, for longer outlines to replace:
+  dict_translation_t history[DICT_HISTORY];
+  uint8_t history_len;
+  dict_stats_t stats;
+} dictionary_t;
+
+extern dictionary_t dictionary;
+
+uint32_t dict_hash(const uint8_t *strokes, uint8_t nstrokes);
+
+// The bucket an outline with hash starts probing at, out of buckets; from
+// the top bits of the hash, leaving the bottom ones for the fingerprint:
+static inline uint32_t dict_home(uint32_t hash, uint32_t buckets)
+{
+  return (uint32_t) (((uint64_t) hash * buckets) >> 32);
+}
+
+// Checks a blob over and looks up on it in place from then on:
+bool dict_attach(dictionary_t *d, const void *blob, size_t size);
+// Attaches the dictionary in the dict partition, if there's an intact one:
+void dict_partition_load(dictionary_t *d);
+
+bool dict_lookup(dictionary_t *d, const uint8_t *strokes, uint8_t nstrokes, const char **text, uint8_t *text_len);
+
+/* Translates the next stroke. The longest outline made up of the latest few
+ * translations and this stroke wins, with the translations it replaces being
+ * backspaced over. Costs at most DICT_HISTORY lookups per stroke.
+ *
+ * Returns false if the stroke isn't part of any outline, for the caller to
+ * handle as usual. It's still kept as a translation of its own, which a later
+ * stroke may extend and take back, if fallback_len (the characters the caller
+ * then puts out) is non-zero. Otherwise, translations so far are forgotten.
+ */
+bool dict_stroke(dictionary_t *d, uint8_t stroke, uint8_t fallback_len, dict_output_t *out);
+
+// Forgets translations so far, e.g. once the cursor may have moved:
+void dict_forget(dictionary_t *d);
+void dict_dump(const dictionary_t *d);
+
+#endif
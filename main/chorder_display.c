@@ -35,6 +35,7 @@ lcd_state_t lcd_state = {
   .success = "",
   .wifi_connected = false,
   .bluetooth_connected = false,
+  .hint_keys = 0,
 };
 
 TickType_t display_timeout_last_activity = 0;
@@ -127,6 +128,7 @@ void render_display_task (void *pvParameters)
   static lcd_state_t last_rendered;
   static lcd_style_t last_style;
   static TickType_t last_popup_tick = 0;
+  static TickType_t last_hint_tick = 0;
 
   if (0 == display_timeout_last_activity)
     display_timeout_last_activity = xTaskGetTickCount();
@@ -187,6 +189,18 @@ void render_display_task (void *pvParameters)
             2),       // margin against edge of screen
           lcd_state.bluetooth_connected ? BLUE : RED);
 
+      // Transition hint, bottom left:
+      if (0 != lcd_state.hint_keys) {
+        unsigned char hint[16] = "hold ";
+        size_t len = strlen((char *)hint);
+        for (int i = 0; i < 7; i++)
+          if (lcd_state.hint_keys & (1 << (6 - i)))
+            hint[len++] = "FCNIMRP"[i];
+        hint[len] = '\0';
+        lcdDrawString(&dev, fx16G, 2, CONFIG_HEIGHT-3, hint, YELLOW);
+        last_hint_tick = xTaskGetTickCount();
+      }
+
       memcpy(&last_rendered,&lcd_state,sizeof(lcd_state_t));
       memcpy(&last_style,&lcd_style,sizeof(lcd_style_t));
     }
@@ -194,6 +208,9 @@ void render_display_task (void *pvParameters)
     int ms_since_last_update = (xTaskGetTickCount()-display_timeout_last_activity)*portTICK_PERIOD_MS;
     int ms_since_last_popup = (xTaskGetTickCount()-last_popup_tick)*portTICK_PERIOD_MS;
 
+    if (0 != lcd_state.hint_keys && (xTaskGetTickCount()-last_hint_tick)*portTICK_PERIOD_MS > 3000) {
+      lcd_state.hint_keys = 0;
+    }
     if (ms_since_last_popup > 5000) {
       strcpy(lcd_state.alert,"");
       strcpy(lcd_state.success,"");
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
 #include "st7789.h"
 #include "config.h"
 
@@ -52,6 +53,7 @@ typedef struct {
   char success[SUCCESS_BUFSIZE];
   bool wifi_connected;
   bool bluetooth_connected;
+  uint8_t hint_keys;        // keys that could have been held over, as a keyState
 } lcd_state_t;
 
 extern lcd_style_t lcd_style;
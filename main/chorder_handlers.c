@@ -0,0 +1,562 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+#include "hid_dev.h"
+#include "config.h"
+
+#include "chorder_display.h"
+#include "chorder_latency.h"
+#include "chorder_handlers.h"
+
+#include "chorder_keymap.h"
+#include "chorder_layers.h"
+#include "chorder_actions.h"
+#include "chorder_snippets.h"
+#include "chorder_dict.h"
+#include "chorder_taphold.h"
+#include "chorder_usage.h"
+#include "chorder_advisor.h"
+#include "chorder_locale.h"
+#include "chorder_unicode.h"
+#include "chorder_keyreport.h"
+#include "chorder_hidtx.h"
+#include "chorder_connparams.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Keyboard state
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+void (*keystate_handler)(uint8_t keyState);
+
+bool isCapsLocked = false;
+keymap_t modKeys = 0x00;
+uint8_t heldModKeys = 0x00;
+
+layer_stack_t keyboard_layers = LAYER_STACK_INIT(KEYMAP_ALPHA);
+layer_stack_t mouse_layers = LAYER_STACK_INIT(KEYMAP_MOUSE);
+layer_stack_t note_layers = LAYER_STACK_INIT(KEYMAP_NOTE_UNSHIFTED);
+
+uint16_t hid_conn_id = 0;
+bool sec_conn = false;
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Keystate handlers per operating mode
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+bool urlencode_into(char *dest, size_t max_dest, const char *unescaped)
+{
+  char *outpos = dest;
+  for(int i=0;i<strlen(unescaped);i++)
+  {
+    char addition[4];
+    if (
+        ('A' <= unescaped[i] && unescaped[i] <= 'Z') ||
+        ('a' <= unescaped[i] && unescaped[i] <= 'z') ||
+        ('0' <= unescaped[i] && unescaped[i] <= '9') ||
+        '-' == unescaped[i] ||
+        '_' == unescaped[i] ||
+        '.' == unescaped[i] ||
+        '~' == unescaped[i])
+    {
+      sprintf(addition,"%c",unescaped[i]);
+    } else {
+      sprintf(addition,"%%%02x",(unsigned char) unescaped[i]);
+    }
+    // Truncated output (written >= space left) doesn't fit, terminator and all:
+    size_t space = max_dest-(outpos-dest);
+    int written = snprintf(outpos,space,"%s",addition);
+    if (written < 0 || (size_t) written >= space)
+      return false;
+    outpos += written;
+  }
+  return true;
+}
+
+
+void release_keys(){
+  uint8_t buf[8];
+  memset(buf,0x00,8);
+  esp_hidd_send_keyboard_value(hid_conn_id,0x00,buf,1);
+}
+
+void sendRawKey(uint8_t modKey, uint8_t rawKey){
+  uint8_t buf[8];
+  memset(buf,0x00,8);
+  buf[0] = rawKey;
+  esp_hidd_send_keyboard_value(hid_conn_id,modKey,buf,1);
+  ESP_LOGD("sendRawKey","esp_hidd_send_keyboard_value(%d,0x%x,0x%x %x %x %x %x %x %x %x)",
+      hid_conn_id,modKey,
+      buf[0],buf[1],buf[2],buf[3],
+      buf[4],buf[5],buf[6],buf[7]);
+  release_keys();
+}
+
+void sendKeys(uint8_t modKey, uint8_t *keys, uint8_t count){
+  esp_hidd_send_keyboard_value(hid_conn_id,modKey,keys,count);
+}
+
+// Types UTF-8 text in the host's layout, a tap per key (and dead key), with
+// modKey held on top, packed several to a report. Characters it doesn't have
+// go through the host's Unicode input method instead, if there's one, or are
+// skipped:
+void sendText(const char *text, size_t len, uint8_t modKey){
+  keyreport_t kr;
+  keyreport_init(&kr, sendKeys);
+  const char *end = text + len;
+  while (text < end) {
+    uint32_t codepoint = locale_utf8_next(&text, end - text);
+    const locale_stroke_t *stroke = locale_lookup(codepoint);
+    if (NULL == stroke) {
+      unicode_report_t reports[UNICODE_MAX_REPORTS];
+      size_t count = unicode_reports(codepoint, reports);
+      if (0 != count)
+        keyreport_flush(&kr);
+      for (size_t i = 0; i < count; i++)
+        sendKeys(reports[i].mod, &reports[i].key, 1);
+      continue;
+    }
+    if (0 != stroke->dead_key)
+      keyreport_tap(&kr, stroke->dead_mod | modKey, stroke->dead_key);
+    keyreport_tap(&kr, stroke->mod | modKey, stroke->key);
+  }
+  keyreport_flush(&kr);
+}
+
+// Presses and releases a consumer control (media) key, by HID_CONSUMER_* usage:
+void sendConsumerKey(uint8_t usage){
+  esp_hidd_send_consumer_value(hid_conn_id,usage,true);
+  esp_hidd_send_consumer_value(hid_conn_id,usage,false);
+}
+
+bool opmode_switch_and_deepsleep_handler (uint8_t keyState)
+{
+  symbol_t symbol = keymap[keyState][KEYMAP_ALPHA];
+  switch (symbol) {
+    case MODE_BLE_KEYBOARD:
+      switch_to_opmode(OPMODE_BLE_KEYBOARD);
+      return true;
+    case MODE_BLE_MOUSE:
+      switch_to_opmode(OPMODE_BLE_MOUSE);
+      return true;
+    case MODE_NOTETAKING:
+      switch_to_opmode(OPMODE_NOTETAKING);
+      return true;
+    case MODE_DEEPSLEEP:
+      strcpy(lcd_state.success,"Entering deep sleep now...");
+      vTaskDelay(2000 / portTICK_PERIOD_MS);
+      send_chorder_to_sleep();
+      return true; // oughtn't actually matter; however, warnings
+    case MODE_DUMP_STATS:
+      latency_dump();
+      speculation_dump();
+      snippet_dump();
+      usage_dump();
+      dict_dump(&dictionary);
+      advisor_dump(&advisor);
+      hid_tx_dump();
+#if CONFIG_CHORDER_CONN_PARAMS
+      connparams_dump();
+#endif
+      strcpy(lcd_state.success,"Stats dumped to console");
+      return true;
+    default:
+      return false;
+  }
+}
+
+/* Redirector, so that the core logic (shifted not shifted) can be managed
+ * centrally:
+ */
+void handle_keystate_update_internally(uint8_t keyState, void (*symbol_handler)(symbol_t input))
+{
+  display_timeout_last_activity = xTaskGetTickCount();
+  symbol_t symbol = layers_lookup(&note_layers, keyState);
+
+  // Dictionary outlines only apply to chords on the base layer:
+  dict_output_t words;
+  if (note_layers.top != note_layers.base) {
+    dict_forget(&dictionary);
+  } else if (dict_stroke(&dictionary, keyState, (symbol >= 0x20 && symbol < 0x7F) ? 1 : 0, &words)) {
+    for (uint16_t i = 0; i < words.backspaces; i++)
+      (*symbol_handler)(NONBLE_BACKSPACE);
+    for (uint8_t i = 0; i < words.text_len; i++)
+      (*symbol_handler)((unsigned char) words.text[i]);
+    layers_key_sent(&note_layers);
+    return;
+  }
+
+  switch (symbol) {
+    case MOD_LSHIFT:
+    case MOD_RSHIFT:
+      layers_oneshot_toggle(&note_layers, KEYMAP_NOTE_SHIFTED);
+      return;
+    case MODE_NUM:
+      layers_push(&note_layers, KEYMAP_NOTE_NUMSYMED, LAYER_ONESHOT, 0);
+      return;
+    default:
+      (*symbol_handler)(symbol);
+      layers_key_sent(&note_layers);
+  }
+}
+
+void printing_handler(symbol_t symbol){
+  static bool initialised = false;
+
+  if (!initialised)
+  {
+    lcd_state.message[0] = '\0';
+    lcd_state.alert[0] = '\0';
+    initialised = true;
+  }
+  
+  switch (symbol) {
+    case NONBLE_BACKSPACE: {
+      // A whole character, which may be several bytes of UTF-8:
+      size_t len = strlen(lcd_state.message);
+      while (len > 0 && 0x80 == (lcd_state.message[--len] & 0xC0))
+        ;
+      lcd_state.message[len] = '\0';
+      break;
+    }
+    case '\n': // sending on enter key presses:
+      if (send_off_note(lcd_state.message)) {
+        strcpy(lcd_state.success,"Sent note off");
+        strcpy(lcd_state.message,"");
+      } else {
+        strcpy(lcd_state.alert,"Couldn't send note!");
+      }
+      break;
+    default:
+      if (symbol < 128) {
+        // Reset alert:
+        lcd_state.alert[0] = '\0';
+
+        // Keep replacing the last character if we're at the buffer size:
+        size_t pos = ((strlen(lcd_state.message) >= INTERNAL_BUFSIZE - 1) ? strlen(lcd_state.message)-1 : strlen(lcd_state.message));
+        lcd_state.message[pos] = (char) symbol;
+        lcd_state.message[pos+1] = '\0';
+      } else if (symbol < 256) {
+        // A byte of UTF-8 text, from the dictionary; rather than replace
+        // part of a character, a full note takes no more of them:
+        size_t len = strlen(lcd_state.message);
+        if (len < INTERNAL_BUFSIZE - 1) {
+          lcd_state.message[len] = (char) symbol;
+          lcd_state.message[len+1] = '\0';
+        }
+      } else {
+        sprintf((char *)lcd_state.alert,"Special: %u",symbol);
+      }
+      break;
+  }
+
+}
+
+void handle_keystate_update_internally_with_printing(uint8_t keyState){
+  handle_keystate_update_internally(keyState,&printing_handler);
+}
+
+// One-shot modifiers and layers only last for a single key:
+static void reset_modes_after_key(layer_stack_t *layers)
+{
+  modKeys = 0x00;
+  layers_key_sent(layers);
+  // Reset the modKeys based on locks
+  if (isCapsLocked){
+    modKeys = 0x02;
+  }
+}
+
+// Characters typing key puts in front of the cursor, for backspacing over:
+static uint8_t typed_length(keymap_t key)
+{
+  if (key < HID_KEY_A || key > HID_KEY_FWD_SLASH)
+    return 0;
+  return (HID_KEY_ESCAPE == key || HID_KEY_DELETE == key) ? 0 : 1;
+}
+
+/* Looks keyState up as the next dictionary stroke, returning whether it's
+ * been typed out as (part of) an outline. sent is how many characters of
+ * theKey have already gone out, as when it's been speculated on, to be taken
+ * back along with earlier translations.
+ */
+static bool dict_translate(uint8_t keyState, keymap_t theKey, uint16_t sent)
+{
+  // Dictionary outlines only apply to chords on the base layer, with no
+  // one-shot modifiers pending:
+  dict_output_t words;
+  if (keyboard_layers.top != keyboard_layers.base || modKeys != (isCapsLocked ? 0x02 : 0x00) || 0 != heldModKeys) {
+    dict_forget(&dictionary);
+    return false;
+  }
+  if (! dict_stroke(&dictionary, keyState, typed_length(theKey), &words))
+    return false;
+  for (uint16_t i = 0; i < sent + words.backspaces; i++)
+    sendRawKey(0x00, HID_KEY_DELETE);
+  sendText(words.text, words.text_len, 0x00);
+  reset_modes_after_key(&keyboard_layers);
+  return true;
+}
+
+void handle_keystate_update_as_ble_keyboard(uint8_t keyState){
+
+  display_timeout_last_activity = xTaskGetTickCount();
+
+  // Determine the key based on the current layer
+  keymap_t theKey = layers_lookup(&keyboard_layers, keyState);
+
+  if (dict_translate(keyState, theKey, 0))
+    return;
+
+  // Modifier toggles and layer switches apply to the next key sent, so only
+  // reset them once keys have actually been sent:
+  if (actions_execute(&keyboard_layers, theKey))
+    reset_modes_after_key(&keyboard_layers);
+}
+
+void handle_keystate_update_as_ble_mouse(uint8_t keyState){
+  static size_t jump = 8;
+  keymap_t theKey;  
+
+  display_timeout_last_activity = xTaskGetTickCount();
+  theKey = layers_lookup(&mouse_layers, keyState);
+  static keymap_t lastKey = 0;
+  
+  if (lastKey == theKey) {
+    jump = 127 > 3 * jump ? 3 * jump : 127;
+  } else {
+    jump = 1;
+  }
+
+  lastKey = theKey;
+
+  switch (theKey)  {
+    case MODE_NOTETAKING:
+      jump = 8;
+      switch_to_opmode(OPMODE_NOTETAKING);
+      return;
+    case MODE_BLE_KEYBOARD:
+      jump = 8;
+      switch_to_opmode(OPMODE_BLE_KEYBOARD);
+      return;
+    case BLEMOUSE_LEFT:
+      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,-jump,0,0);
+      break;
+    case BLEMOUSE_DOWN:
+      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,0,-jump,0);
+      break;
+    case BLEMOUSE_UP:
+      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,0,jump,0);
+      break;
+    case BLEMOUSE_RIGHT:
+      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,jump,0,0);
+      break;
+    case BLEMOUSE_1CLICK:
+      if (sec_conn) {
+        esp_hidd_send_mouse_value(hid_conn_id,1,0,0,0);
+        esp_hidd_send_mouse_value(hid_conn_id,0,0,0,0);
+      }
+      break;
+    default:
+      strcpy(lcd_state.alert,"Unknown\nkey");
+      break;
+  }
+
+  reset_modes_after_key(&mouse_layers);
+}
+
+void switch_to_opmode(enum Operating_mode target){
+  static int last_opmode = -1;
+  switch(last_opmode) {
+    case OPMODE_BLE_KEYBOARD:
+      ESP_LOGI(__FUNCTION__, "Coming out of BLE Keyboard mode; releasing keys");
+      release_keys();
+      break;
+    default:
+      break;
+  }
+  switch(target) {
+    case OPMODE_NOTETAKING:
+      keystate_handler = &handle_keystate_update_internally_with_printing;
+      layers_reset(&note_layers);
+      lcd_style.background_color = DARK_RED;
+      break;
+    case OPMODE_BLE_KEYBOARD:
+      keystate_handler = &handle_keystate_update_as_ble_keyboard;
+      layers_reset(&keyboard_layers);
+      modKeys = 0x00;
+      heldModKeys = 0x00;
+      isCapsLocked = false;
+      lcd_style.background_color = BLUE;
+      break;
+    case OPMODE_BLE_MOUSE:
+      keystate_handler = &handle_keystate_update_as_ble_mouse;
+      layers_reset(&mouse_layers);
+      lcd_style.background_color = CYAN;
+      break;
+    default:
+      ESP_LOGE(__FUNCTION__,"Wrong switch_to_mode chosen.");
+  }
+  dict_forget(&dictionary);
+  last_opmode = target;
+}
+
+uint8_t current_layer(void)
+{
+  if (&handle_keystate_update_as_ble_keyboard == keystate_handler)
+    return keyboard_layers.top;
+  if (&handle_keystate_update_as_ble_mouse == keystate_handler)
+    return mouse_layers.top;
+  return note_layers.top;
+}
+
+bool hold_roles_apply(void)
+{
+  return &handle_keystate_update_as_ble_keyboard == keystate_handler;
+}
+
+void handle_hold(uint8_t chord, bool held)
+{
+  const hold_binding_t *binding = &hold_bindings[chord];
+  switch (binding->role) {
+    case HOLD_MODIFIER:
+      heldModKeys = held ? heldModKeys | binding->arg : heldModKeys & ~binding->arg;
+      break;
+    case HOLD_LAYER:
+      // Lapses by itself, once the chord's keys are all up:
+      if (held)
+        layers_push(&keyboard_layers, binding->arg, LAYER_MOMENTARY, chord);
+      break;
+    default:
+      break;
+  }
+}
+
+void handle_keys_held(uint8_t keyState)
+{
+  layers_keys_held(&keyboard_layers, keyState);
+  layers_keys_held(&mouse_layers, keyState);
+  layers_keys_held(&note_layers, keyState);
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Speculative output
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+speculation_stats_t speculation_stats;
+
+// The keyState whose key has been sent ahead of its commit, if any:
+static uint8_t speculated_keyState = 0;
+
+static void retract_speculation(void)
+{
+  sendRawKey(0x00, HID_KEY_DELETE);
+  speculation_stats.mispredictions++;
+  speculated_keyState = 0;
+}
+
+bool speculate_keystate(uint8_t keyState)
+{
+  if (keyState == speculated_keyState)
+    return true;
+  if (0 != speculated_keyState)
+    retract_speculation();
+
+  if (keystate_handler != &handle_keystate_update_as_ble_keyboard)
+    return false;
+  // Only keys typing a single character, shifted or not, are sent ahead;
+  // Enter, Tab, arrows, mode changes, macros or a pending Ctrl (making a W a
+  // Ctrl+W) can't be taken back with a single backspace:
+  keymap_t theKey = layers_lookup(&keyboard_layers, keyState);
+  if (1 != typed_length(theKey) || HID_KEY_RETURN == theKey || HID_KEY_TAB == theKey)
+    return false;
+  if (0 != ((modKeys | heldModKeys) & ~(LEFT_SHIFT_KEY_MASK | RIGHT_SHIFT_KEY_MASK)))
+    return false;
+
+  display_timeout_last_activity = xTaskGetTickCount();
+  sendRawKey(modKeys | heldModKeys, theKey);
+  speculated_keyState = keyState;
+  speculation_stats.speculations++;
+  return true;
+}
+
+bool settle_speculation(uint8_t keyState)
+{
+  if (0 == speculated_keyState)
+    return false;
+  if (keyState != speculated_keyState) {
+    retract_speculation();
+    return false;
+  }
+  // The key is already out; it's still a dictionary stroke, which may take
+  // it back for an outline's translation. Otherwise, only the modes it used
+  // up remain to be reset:
+  speculated_keyState = 0;
+  speculation_stats.hits++;
+  if (! dict_translate(keyState, layers_lookup(&keyboard_layers, keyState), 1))
+    reset_modes_after_key(&keyboard_layers);
+  return true;
+}
+
+void speculation_dump(void)
+{
+  ESP_LOGI(__FUNCTION__, "speculations=%u hits=%u mispredictions=%u",
+      (unsigned) speculation_stats.speculations,
+      (unsigned) speculation_stats.hits,
+      (unsigned) speculation_stats.mispredictions);
+}
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Typematic repeat
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+// What the held chord was first typed as, in BLE keyboard mode:
+static keymap_t repeat_key;
+static uint8_t repeat_modKeys;
+
+bool typematic_applies(uint8_t keyState)
+{
+  if (&handle_keystate_update_as_ble_keyboard == keystate_handler) {
+    keymap_t theKey = layers_lookup(&keyboard_layers, keyState);
+    return theKey < DIV_nonkeys_offset && 0 != theKey && HID_KEY_CAPS_LOCK != theKey && 0 == typed_length(theKey);
+  }
+  if (&handle_keystate_update_internally_with_printing == keystate_handler)
+    return NONBLE_BACKSPACE == layers_lookup(&note_layers, keyState);
+  return false;
+}
+
+bool typematic_type(uint8_t keyState, bool first)
+{
+  if (first) {
+    // Typed as it would be on release, modes and dictionary and all; should
+    // that turn out to be anything but the key, it's not repeated:
+    void (*handler)(uint8_t) = keystate_handler;
+    uint32_t translations = dictionary.stats.translations;
+    repeat_key = layers_lookup(&keyboard_layers, keyState);
+    repeat_modKeys = modKeys;
+    if (! settle_speculation(keyState) && ! opmode_switch_and_deepsleep_handler(keyState))
+      (*keystate_handler)(keyState);
+    return handler == keystate_handler && translations == dictionary.stats.translations;
+  }
+
+  display_timeout_last_activity = xTaskGetTickCount();
+  if (&handle_keystate_update_as_ble_keyboard == keystate_handler)
+    sendRawKey(repeat_modKeys | heldModKeys, repeat_key);
+  else
+    printing_handler(NONBLE_BACKSPACE);
+  return true;
+}
+
+// }}}
@@ -0,0 +1,94 @@
+#ifndef _CHORDER_HANDLERS_H_
+#define _CHORDER_HANDLERS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chorder_layers.h"
+
+enum Operating_mode {
+  OPMODE_NOTETAKING,
+  OPMODE_BLE_KEYBOARD,
+  OPMODE_BLE_MOUSE,
+};
+
+// the current function that'll take keystate updates:
+// This receives a shifted-into-place bit string of the latest key press
+extern void (*keystate_handler)(uint8_t keyState);
+
+extern bool isCapsLocked;
+extern uint16_t modKeys;
+// Modifiers held by tap-hold chords, on top of modKeys:
+extern uint8_t heldModKeys;
+
+// The keymap layers in effect, per operating mode:
+extern layer_stack_t keyboard_layers;
+extern layer_stack_t mouse_layers;
+extern layer_stack_t note_layers;
+
+// The BLE connection keys are sent over, as maintained by main.c's callbacks:
+extern uint16_t hid_conn_id;
+extern bool sec_conn;
+
+bool urlencode_into(char *dest, size_t max_dest, const char *unescaped);
+
+void release_keys();
+void sendRawKey(uint8_t modKey, uint8_t rawKey);
+// Sends a keyboard report as is, of up to six keys, without releasing them:
+void sendKeys(uint8_t modKey, uint8_t *keys, uint8_t count);
+void sendConsumerKey(uint8_t usage);
+void sendText(const char *text, size_t len, uint8_t modKey);
+
+bool opmode_switch_and_deepsleep_handler (uint8_t keyState);
+void handle_keystate_update_internally(uint8_t keyState, void (*symbol_handler)(uint16_t input));
+void printing_handler(uint16_t symbol);
+void handle_keystate_update_internally_with_printing(uint8_t keyState);
+void handle_keystate_update_as_ble_keyboard(uint8_t keyState);
+void handle_keystate_update_as_ble_mouse(uint8_t keyState);
+void switch_to_opmode(enum Operating_mode target);
+// Fed every debounced keyState, so momentary layers lapse as their keys come up:
+void handle_keys_held(uint8_t keyState);
+// The keymap layer the next chord will be looked up on, in the current opmode:
+uint8_t current_layer(void);
+// Whether tap-hold chords are resolved as holds in the current opmode:
+bool hold_roles_apply(void);
+// A tap-hold chord was resolved as held, or has since let go:
+void handle_hold(uint8_t chord, bool held);
+
+/* Speculative output, for chords held still long enough to be taken as what's
+ * about to be committed. Only plain keys in BLE keyboard mode are sent ahead:
+ * ones typing a single character, with no modifier but Shift active or pending.
+ * Sending a different keyState ahead, or settling on a different chord than
+ * was sent, first takes the earlier key back with a backspace.
+ */
+typedef struct {
+  uint32_t speculations;                   // keys sent ahead of their commit
+  uint32_t hits;                           // ... that were then committed
+  uint32_t mispredictions;                 // ... that had to be taken back
+} speculation_stats_t;
+
+extern speculation_stats_t speculation_stats;
+
+// Sends keyState's key ahead of its commit; false if it can't be:
+bool speculate_keystate(uint8_t keyState);
+// Called with each committed chord; true if its key was already sent, in
+// which case it's also been fed to the dictionary as a stroke:
+bool settle_speculation(uint8_t keyState);
+void speculation_dump(void);
+
+/* Typematic repeat, for chords held still (see chorder_typematic.h). Keys
+ * that don't type characters repeat in BLE keyboard mode, as does backspace
+ * in note-taking mode.
+ */
+// Whether keyState repeats when held, in the current opmode:
+bool typematic_applies(uint8_t keyState);
+// Types keyState as held: the first time as if committed, then as a repeat
+// of that. Returns false if it's not to be repeated after all:
+bool typematic_type(uint8_t keyState, bool first);
+
+// Implemented in main.c, alongside the rest of the hardware handling:
+void send_chorder_to_sleep (void);
+bool send_off_note(char *note);
+
+#endif
@@ -0,0 +1,300 @@
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_gap_ble_api.h"
+#include "esp_gatts_api.h"
+#include "sdkconfig.h"
+
+#include "chorder_latency.h"
+#include "chorder_hidtx.h"
+
+hid_tx_stats_t hid_tx_stats;
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static QueueHandle_t queue = NULL;
+static TaskHandle_t bulk_sender = NULL;
+static TaskHandle_t decoder = NULL;
+static TaskHandle_t transmitter = NULL;
+// Queue slots taken, by reports queued or about to be, and how many of those
+// are the bulk sender's; given back as reports go out:
+static portMUX_TYPE slots_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t slots_used = 0;
+static uint32_t bulk_slots_used = 0;
+// For the transmit task to wake whoever's waiting for a slot:
+static volatile bool bulk_waiting = false;
+static volatile bool decoder_waiting = false;
+// The decoder's reports waiting for room, oldest first; only the decoder
+// touches these:
+static hid_tx_report_t backlog[HID_TX_BACKLOG_LEN];
+static uint32_t backlog_start = 0;
+static uint32_t backlog_count = 0;
+static bool oldest_deferred = false;       // counted as deferred already
+static esp_timer_handle_t wake_timer;
+static volatile uint32_t interval_us = HID_TX_DEFAULT_INTERVAL_US;
+static volatile bool connected = false;
+// Set on disconnect, for the task to empty the queue; it's the only one
+// taking reports off, so that it never takes off one it hasn't sent:
+static volatile bool flush_pending = false;
+
+// Wakes the task (passed as arg) once it's waited long enough, to the
+// microsecond rather than to the tick:
+static void wake_transmitter(void *arg)
+{
+  xTaskNotifyGive((TaskHandle_t) arg);
+}
+
+static void count(uint32_t *counter)
+{
+  portENTER_CRITICAL(&stats_lock);
+  (*counter)++;
+  portEXIT_CRITICAL(&stats_lock);
+}
+
+static void wait_us(int64_t us)
+{
+  // A notification left over from a disconnect, or a timer that went off
+  // as it was being stopped, mustn't cut this wait short:
+  ulTaskNotifyTake(pdTRUE, 0);
+  esp_timer_stop(wake_timer);
+  esp_timer_start_once(wake_timer, us > 0 ? us : 1);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+// Takes slots for count reports, all or none, the bulk sender only up to
+// HID_TX_RESERVED short of full:
+static bool take_slots(uint32_t count, bool bulk)
+{
+  portENTER_CRITICAL(&slots_lock);
+  bool room = slots_used + count <= HID_TX_QUEUE_LEN
+    && (!bulk || bulk_slots_used + count <= HID_TX_QUEUE_LEN - HID_TX_RESERVED);
+  if (room) {
+    slots_used += count;
+    if (bulk)
+      bulk_slots_used += count;
+  }
+  portEXIT_CRITICAL(&slots_lock);
+  return room;
+}
+
+// For the transmit task, as each report is taken off:
+static void give_slot(bool bulk)
+{
+  portENTER_CRITICAL(&slots_lock);
+  slots_used--;
+  if (bulk)
+    bulk_slots_used--;
+  portEXIT_CRITICAL(&slots_lock);
+  if (bulk_waiting && NULL != bulk_sender)
+    xTaskNotifyGive(bulk_sender);
+  if (decoder_waiting && NULL != decoder)
+    xTaskNotifyGive(decoder);
+}
+
+// Into a slot taken for it, so this never fails:
+static void enqueue(const hid_tx_report_t *entry)
+{
+  xQueueSend(queue, entry, 0);
+  uint32_t depth = uxQueueMessagesWaiting(queue);
+  portENTER_CRITICAL(&stats_lock);
+  hid_tx_stats.queued++;
+  if (depth > hid_tx_stats.max_depth)
+    hid_tx_stats.max_depth = depth;
+  portEXIT_CRITICAL(&stats_lock);
+}
+
+void hid_tx_init(void)
+{
+  queue = xQueueCreate(HID_TX_QUEUE_LEN, sizeof(hid_tx_report_t));
+  if (NULL == queue)
+    ESP_LOGE(__FUNCTION__, "Cannot create the HID report queue");
+}
+
+void hid_tx_set_bulk_sender(TaskHandle_t task)
+{
+  bulk_sender = task;
+}
+
+void hid_tx_set_decoder(TaskHandle_t task)
+{
+  decoder = task;
+}
+
+void hid_tx_admit(void)
+{
+  while (0 != backlog_count) {
+    if (!connected) {
+      backlog_count--;
+      count(&hid_tx_stats.dropped);
+      continue;
+    }
+    // The oldest sequence, up to the report that leaves every key up:
+    uint32_t length = 0;
+    while (length < backlog_count && !backlog[(backlog_start + length) % HID_TX_BACKLOG_LEN].keys_up)
+      length++;
+    bool finished = length < backlog_count;
+    if (finished)
+      length++;
+    if (length > HID_TX_QUEUE_LEN || (!finished && HID_TX_BACKLOG_LEN == backlog_count)) {
+      // It'll never fit whole, so goes in report by report:
+      if (!take_slots(1, false))
+        break;
+      length = 1;
+    } else if (!finished) {
+      // The decoder's still sending the rest of it:
+      break;
+    } else if (!take_slots(length, false)) {
+      if (!oldest_deferred)
+        count(&hid_tx_stats.deferred);
+      oldest_deferred = true;
+      break;
+    }
+    oldest_deferred = false;
+    for (uint32_t i = 0; i < length; i++) {
+      enqueue(&backlog[backlog_start]);
+      backlog_start = (backlog_start + 1) % HID_TX_BACKLOG_LEN;
+      backlog_count--;
+    }
+  }
+  decoder_waiting = 0 != backlog_count;
+}
+
+bool hid_tx_queue(const hid_tx_report_t *report)
+{
+  if (NULL == queue || !connected) {
+    count(&hid_tx_stats.dropped);
+    return false;
+  }
+  hid_tx_report_t entry = *report;
+  entry.bulk = NULL != bulk_sender && xTaskGetCurrentTaskHandle() == bulk_sender;
+  if (entry.bulk) {
+    entry.edge_time = 0;
+    entry.decode_time = 0;
+    // Waits as long as it takes; set before trying, for a slot given back
+    // meanwhile to wake it:
+    bulk_waiting = true;
+    while (!take_slots(1, true)) {
+      if (!connected) {
+        bulk_waiting = false;
+        count(&hid_tx_stats.dropped);
+        return false;
+      }
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    bulk_waiting = false;
+    enqueue(&entry);
+    return true;
+  }
+
+  latency_take_decode(&entry.edge_time, &entry.decode_time);
+  // Reports already waiting go first; only a full backlog is waited on:
+  hid_tx_admit();
+  while (HID_TX_BACKLOG_LEN == backlog_count) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    hid_tx_admit();
+  }
+  backlog[(backlog_start + backlog_count) % HID_TX_BACKLOG_LEN] = entry;
+  backlog_count++;
+  hid_tx_admit();
+  portENTER_CRITICAL(&stats_lock);
+  if (backlog_count > hid_tx_stats.max_backlog)
+    hid_tx_stats.max_backlog = backlog_count;
+  portEXIT_CRITICAL(&stats_lock);
+  return true;
+}
+
+void hid_tx_set_connected(bool is_connected)
+{
+  connected = is_connected;
+  if (!is_connected) {
+    flush_pending = true;
+    if (NULL != transmitter)
+      xTaskNotifyGive(transmitter);
+    // For any sender waiting on a slot to give up:
+    if (bulk_waiting && NULL != bulk_sender)
+      xTaskNotifyGive(bulk_sender);
+    if (decoder_waiting && NULL != decoder)
+      xTaskNotifyGive(decoder);
+  }
+}
+
+void hid_tx_set_interval(uint32_t us)
+{
+  ESP_LOGI(__FUNCTION__, "Connection interval: %u us", (unsigned) us);
+  interval_us = us;
+}
+
+uint32_t hid_tx_depth(void)
+{
+  return NULL == queue ? 0 : uxQueueMessagesWaiting(queue);
+}
+
+void hid_tx_task(void *pvParameters)
+{
+  transmitter = xTaskGetCurrentTaskHandle();
+  const esp_timer_create_args_t wake_timer_args = {
+    .callback = wake_transmitter,
+    .arg = transmitter,
+    .name = "hid_tx",
+  };
+  ESP_ERROR_CHECK(esp_timer_create(&wake_timer_args, &wake_timer));
+
+  int64_t window_start = 0;
+  uint32_t window_sent = 0;
+  hid_tx_report_t report;
+  while (1) {
+    if (flush_pending) {
+      flush_pending = false;
+      while (pdTRUE == xQueueReceive(queue, &report, 0)) {
+        give_slot(report.bulk);
+        count(&hid_tx_stats.dropped);
+      }
+    }
+    // Left on the queue until it's been sent:
+    if (pdTRUE != xQueuePeek(queue, &report, pdMS_TO_TICKS(1000)))
+      continue;
+
+    int64_t now = esp_timer_get_time();
+    if (now - window_start >= interval_us) {
+      window_start = now;
+      window_sent = 0;
+    }
+    if (window_sent >= CONFIG_CHORDER_HID_TX_PER_INTERVAL) {
+      wait_us(window_start + interval_us - now);
+      continue;
+    }
+    // Anything more would only pile up in (and maybe be dropped by) the
+    // stack; wait for the controller to get a connection event's worth out:
+    if (0 == esp_ble_get_cur_sendable_packets_num(report.conn_id)) {
+      count(&hid_tx_stats.stalls);
+      wait_us(interval_us);
+      continue;
+    }
+    if (ESP_OK != esp_ble_gatts_send_indicate(report.gatts_if, report.conn_id, report.handle, report.len, report.data, false)) {
+      count(&hid_tx_stats.retries);
+      wait_us(interval_us);
+      continue;
+    }
+    latency_mark_notify(report.edge_time, report.decode_time);
+    xQueueReceive(queue, &report, 0);
+    give_slot(report.bulk);
+    count(&hid_tx_stats.sent);
+    window_sent++;
+  }
+}
+
+void hid_tx_dump(void)
+{
+  portENTER_CRITICAL(&stats_lock);
+  hid_tx_stats_t stats = hid_tx_stats;
+  portEXIT_CRITICAL(&stats_lock);
+  ESP_LOGI(__FUNCTION__, "HID reports: %u queued, %u sent, %u dropped, %u stalls, %u retries; queue depth %u now, %u at most; "
+      "%u sequences deferred, %u reports backlogged at most; interval %u us",
+      (unsigned) stats.queued, (unsigned) stats.sent, (unsigned) stats.dropped,
+      (unsigned) stats.stalls, (unsigned) stats.retries,
+      (unsigned) hid_tx_depth(), (unsigned) stats.max_depth,
+      (unsigned) stats.deferred, (unsigned) stats.max_backlog, (unsigned) interval_us);
+}
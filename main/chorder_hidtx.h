@@ -0,0 +1,92 @@
+#ifndef _CHORDER_HIDTX_H_
+#define _CHORDER_HIDTX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_gatt_defs.h"
+
+/* Transmit queue for HID reports: hid_dev_send_report() queues reports
+ * rather than firing them straight into the BLE stack, and hid_tx_task sends
+ * them on, in order. No more than CONFIG_CHORDER_HID_TX_PER_INTERVAL go out
+ * per connection interval, and only while the controller has a buffer free
+ * for the connection; otherwise the task waits for the next interval.
+ *
+ * Reports are only ever dropped without a connection to send them over. The
+ * bulk sender (the snippet task) blocks while the queue's full, so that a
+ * snippet is slowed down to what the link takes, and may only fill it up to
+ * HID_TX_RESERVED short of full. The rest is kept for the decoder, so that
+ * its chords don't wait behind a snippet's backlog.
+ *
+ * The decoder doesn't block on the queue. Its reports go in a press...release
+ * sequence (up to a report leaving every key up) at a time, and only once
+ * there's room for all of it, so that the host never sees a key held down
+ * for want of room for its release. Sequences waiting for room are kept in a
+ * backlog of HID_TX_BACKLOG_LEN reports, in order, and the decoder is woken
+ * to admit them (hid_tx_admit()) as reports go out. Only a sequence longer
+ * than the queue goes in piecemeal, and only a full backlog makes the decoder
+ * wait.
+ */
+#define HID_TX_QUEUE_LEN        64
+#define HID_TX_RESERVED         16
+#define HID_TX_BACKLOG_LEN      64
+#define HID_TX_REPORT_MAX_LEN   8
+// Until the connection's own interval is known; the middle of what's
+// advertised as preferred:
+#define HID_TX_DEFAULT_INTERVAL_US 15000
+
+typedef struct {
+  esp_gatt_if_t gatts_if;
+  uint16_t conn_id;
+  uint16_t handle;                         // of the report characteristic
+  uint8_t len;
+  uint8_t data[HID_TX_REPORT_MAX_LEN];
+  bool keys_up;                            // leaves no key or button down
+  // Set as it's queued: whether the bulk sender queued it, and the latency
+  // timestamps of the chord it's the first report of (see chorder_latency.h):
+  bool bulk;
+  int64_t edge_time;
+  int64_t decode_time;
+} hid_tx_report_t;
+
+typedef struct {
+  uint32_t queued;
+  uint32_t sent;
+  uint32_t dropped;                        // without a connection to send them over
+  uint32_t stalls;                         // waits for the controller to free a buffer
+  uint32_t retries;                        // sends the stack turned down, and tried again
+  uint32_t max_depth;                      // most reports queued at once
+  uint32_t deferred;                       // decoder sequences that waited for room
+  uint32_t max_backlog;                    // most decoder reports waiting at once
+} hid_tx_stats_t;
+
+// Counted from every sender's task and the transmit task, under a lock:
+extern hid_tx_stats_t hid_tx_stats;
+
+// Creates the queue; to be called before any report is sent:
+void hid_tx_init(void);
+// The task whose reports are paced to the link (see above); any other
+// sender is taken to be the decoder:
+void hid_tx_set_bulk_sender(TaskHandle_t task);
+// The decoder, to wake while its reports wait for room:
+void hid_tx_set_decoder(TaskHandle_t task);
+// Queues a report, the bulk sender blocking while there's no room for it
+// and the decoder's waiting in the backlog; false if it's dropped:
+bool hid_tx_queue(const hid_tx_report_t *report);
+// Admits the decoder's backlogged sequences there's room for by now; only
+// for the decoder:
+void hid_tx_admit(void);
+// Whether there's a secured connection to send over; reports still queued
+// when it goes away are dropped:
+void hid_tx_set_connected(bool connected);
+// The connection interval, as agreed with the host:
+void hid_tx_set_interval(uint32_t interval_us);
+// Reports waiting to be sent:
+uint32_t hid_tx_depth(void);
+
+void hid_tx_task(void *pvParameters);
+void hid_tx_dump(void);
+
+#endif
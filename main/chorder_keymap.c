@@ -0,0 +1,268 @@
+// Generated by host/keymap_gen from keymap.chords; edit that instead.
+#include "hid_dev.h"
+#include "chorder_keymap.h"
+
+const symbol_t keymap_builtin[KEYMAP_CHORDS][KEYMAP_LAYERS] = {
+  /* --- ---- 0x00 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --- ---P 0x01 */ { HID_KEY_W, HID_KEY_5, HID_KEY_F5, BLEMOUSE_RIGHT, 'W', 'w', '5' },
+  /* --- --R- 0x02 */ { HID_KEY_Y, HID_KEY_4, HID_KEY_F4, BLEMOUSE_DOWN, 'Y', 'y', '4' },
+  /* --- --RP 0x03 */ { HID_KEY_U, MACRO_quotes, MEDIA_volup, HID_KEY_RESERVED, 'U', 'u', NONBLE_NOKEY },
+  /* --- -M-- 0x04 */ { HID_KEY_R, HID_KEY_3, HID_KEY_F3, BLEMOUSE_UP, 'R', 'r', '3' },
+  /* --- -M-P 0x05 */ { MACRO_closeparen, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, ')', ')', NONBLE_NOKEY },
+  /* --- -MR- 0x06 */ { HID_KEY_H, MACRO_00, HID_KEY_RESERVED, HID_KEY_RESERVED, 'H', 'h', NONBLE_NOKEY },
+  /* --- -MRP 0x07 */ { HID_KEY_S, HID_KEY_MINUS, MEDIA_stop, HID_KEY_RESERVED, 'S', 's', '-' },
+  /* --- I--- 0x08 */ { HID_KEY_I, HID_KEY_2, HID_KEY_F2, BLEMOUSE_LEFT, 'I', 'i', '2' },
+  /* --- I--P 0x09 */ { HID_KEY_B, HID_KEY_BACK_SLASH, MEDIA_previous, HID_KEY_RESERVED, 'B', 'b', '\\' },
+  /* --- I-R- 0x0A */ { HID_KEY_K, MACRO_dollar, SNIPPET_0, HID_KEY_RESERVED, 'K', 'k', '$' },
+  /* --- I-RP 0x0B */ { HID_KEY_Z, HID_KEY_GRV_ACCENT, SNIPPET_1, HID_KEY_RESERVED, 'Z', 'z', '`' },
+  /* --- IM-- 0x0C */ { HID_KEY_D, HID_KEY_FWD_SLASH, MEDIA_voldn, HID_KEY_RESERVED, 'D', 'd', '/' },
+  /* --- IM-P 0x0D */ { MACRO_openparen, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, '(', '(', NONBLE_NOKEY },
+  /* --- IMR- 0x0E */ { HID_KEY_E, HID_KEY_EQUAL, HID_KEY_RESERVED, HID_KEY_RESERVED, 'E', 'e', '=' },
+  /* --- IMRP 0x0F */ { HID_KEY_T, MACRO_000, HID_KEY_RESERVED, HID_KEY_RESERVED, 'T', 't', NONBLE_NOKEY },
+  /* --N ---- 0x10 */ { MODE_NUM, HID_KEY_SPACEBAR, HID_KEY_RESERVED, BLEMOUSE_FURTHER, MODE_NUM, MODE_NUM, ' ' },
+  /* --N ---P 0x11 */ { MODE_FUNC, MODE_FUNC, MODE_RESET, HID_KEY_RESERVED, MODE_FUNC, MODE_FUNC, MODE_FUNC },
+  /* --N --R- 0x12 */ { HID_KEY_ESCAPE, HID_KEY_ESCAPE, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --N --RP 0x13 */ { HID_KEY_SEMI_COLON, HID_KEY_SEMI_COLON, HID_KEY_RESERVED, HID_KEY_RESERVED, ':', ';', ';' },
+  /* --N -M-- 0x14 */ { HID_KEY_COMMA, HID_KEY_COMMA, HID_KEY_RESERVED, HID_KEY_RESERVED, '<', ',', ',' },
+  /* --N -M-P 0x15 */ { MACRO_closecurly, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, '}', '}', NONBLE_NOKEY },
+  /* --N -MR- 0x16 */ { HID_KEY_DOT, HID_KEY_DOT, HID_KEY_RESERVED, HID_KEY_RESERVED, '>', '.', '.' },
+  /* --N -MRP 0x17 */ { MOD_LALT, MOD_LALT, MOD_LALT, HID_KEY_RESERVED, MOD_LALT, MOD_LALT, MOD_LALT },
+  /* --N I--- 0x18 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --N I--P 0x19 */ { HID_KEY_INSERT, HID_KEY_INSERT, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --N I-R- 0x1A */ { MOD_LGUI, MOD_LGUI, MOD_LGUI, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --N I-RP 0x1B */ { MOD_LCTRL, MOD_LCTRL, MOD_LCTRL, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --N IM-- 0x1C */ { HID_KEY_F9, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* --N IM-P 0x1D */ { MACRO_opencurly, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, '{', '{', NONBLE_NOKEY },
+  /* --N IMR- 0x1E */ { HID_KEY_SGL_QUOTE, HID_KEY_SGL_QUOTE, HID_KEY_RESERVED, HID_KEY_RESERVED, '"', '\'', '\'' },
+  /* --N IMRP 0x1F */ { HID_KEY_NUM_LOCK, MODE_RESET, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, MODE_RESET },
+  /* -C- ---- 0x20 */ { HID_KEY_SPACEBAR, HID_KEY_1, HID_KEY_F1, HID_KEY_RESERVED, ' ', ' ', '1' },
+  /* -C- ---P 0x21 */ { HID_KEY_F, HID_KEY_9, HID_KEY_F9, HID_KEY_RESERVED, 'F', 'f', '9' },
+  /* -C- --R- 0x22 */ { HID_KEY_G, HID_KEY_8, HID_KEY_F8, HID_KEY_RESERVED, 'G', 'g', '8' },
+  /* -C- --RP 0x23 */ { HID_KEY_V, HID_KEY_RIGHT_BRKT, HID_KEY_F12, HID_KEY_RESERVED, 'V', 'v', ']' },
+  /* -C- -M-- 0x24 */ { HID_KEY_C, HID_KEY_7, HID_KEY_F7, HID_KEY_RESERVED, 'C', 'c', '7' },
+  /* -C- -M-P 0x25 */ { HID_KEY_RIGHT_BRKT, HID_KEY_RIGHT_BRKT, HID_KEY_RESERVED, HID_KEY_RESERVED, '[', '[', ']' },
+  /* -C- -MR- 0x26 */ { HID_KEY_P, MACRO_percent, HID_KEY_F11, HID_KEY_RESERVED, 'P', 'p', '%' },
+  /* -C- -MRP 0x27 */ { HID_KEY_N, HID_KEY_LEFT_BRKT, HID_KEY_RESERVED, HID_KEY_RESERVED, 'N', 'n', '[' },
+  /* -C- I--- 0x28 */ { HID_KEY_L, HID_KEY_6, HID_KEY_F6, BLEMOUSE_1CLICK, 'L', 'l', '6' },
+  /* -C- I--P 0x29 */ { HID_KEY_X, MACRO_ampersand, HID_KEY_RESERVED, HID_KEY_RESERVED, 'X', 'x', '&' },
+  /* -C- I-R- 0x2A */ { HID_KEY_J, MACRO_parens, HID_KEY_RESERVED, HID_KEY_RESERVED, 'J', 'j', NONBLE_NOKEY },
+  /* -C- I-RP 0x2B */ { HID_KEY_Q, MACRO_question, HID_KEY_RESERVED, HID_KEY_RESERVED, 'Q', 'q', '?' },
+  /* -C- IM-- 0x2C */ { HID_KEY_M, MACRO_asterisk, HID_KEY_F10, HID_KEY_RESERVED, 'M', 'm', '*' },
+  /* -C- IM-P 0x2D */ { HID_KEY_LEFT_BRKT, HID_KEY_LEFT_BRKT, HID_KEY_RESERVED, HID_KEY_RESERVED, ']', ']', '[' },
+  /* -C- IMR- 0x2E */ { HID_KEY_A, MACRO_plus, HID_KEY_RESERVED, HID_KEY_RESERVED, 'A', 'a', '+' },
+  /* -C- IMRP 0x2F */ { HID_KEY_O, HID_KEY_0, HID_KEY_RESERVED, HID_KEY_RESERVED, 'O', 'o', '0' },
+  /* -CN ---- 0x30 */ { MULTI_NumShift, MULTI_NumShift, MULTI_NumShift, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN ---P 0x31 */ { MODE_NOTETAKING, MODE_NOTETAKING, MODE_NOTETAKING, MODE_NOTETAKING, MODE_NOTETAKING, MODE_NOTETAKING, MODE_NOTETAKING },
+  /* -CN --R- 0x32 */ { MODE_BLE_KEYBOARD, MODE_BLE_KEYBOARD, MODE_BLE_KEYBOARD, MODE_BLE_KEYBOARD, MODE_BLE_KEYBOARD, MODE_BLE_KEYBOARD, MODE_BLE_KEYBOARD },
+  /* -CN --RP 0x33 */ { MODE_DUMP_STATS, MODE_DUMP_STATS, MODE_DUMP_STATS, MODE_DUMP_STATS, MODE_DUMP_STATS, MODE_DUMP_STATS, MODE_DUMP_STATS },
+  /* -CN -M-- 0x34 */ { MODE_BLE_MOUSE, MODE_BLE_MOUSE, MODE_BLE_MOUSE, MODE_BLE_MOUSE, MODE_BLE_MOUSE, MODE_BLE_MOUSE, MODE_BLE_MOUSE },
+  /* -CN -M-P 0x35 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN -MR- 0x36 */ { ANDROID_home, ANDROID_home, ANDROID_home, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN -MRP 0x37 */ { MOD_RALT, MOD_RALT, MOD_RALT, HID_KEY_RESERVED, MOD_RALT, MOD_RALT, MOD_RALT },
+  /* -CN I--- 0x38 */ { MODE_DEEPSLEEP, MODE_DEEPSLEEP, MODE_DEEPSLEEP, MODE_DEEPSLEEP, MODE_DEEPSLEEP, MODE_DEEPSLEEP, MODE_DEEPSLEEP },
+  /* -CN I--P 0x39 */ { ANDROID_back, ANDROID_back, ANDROID_back, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN I-R- 0x3A */ { MOD_RGUI, MOD_RGUI, MOD_RGUI, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN I-RP 0x3B */ { MOD_RCTRL, MOD_RCTRL, MOD_RCTRL, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN IM-- 0x3C */ { ANDROID_menu, ANDROID_menu, ANDROID_menu, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN IM-P 0x3D */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN IMR- 0x3E */ { ANDROID_search, ANDROID_search, ANDROID_search, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* -CN IMRP 0x3F */ { HID_KEY_NUM_LOCK, HID_KEY_NUM_LOCK, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- ---- 0x40 */ { MOD_LSHIFT, MOD_LSHIFT, MOD_LSHIFT, BLEMOUSE_SHORTER, MOD_LSHIFT, MOD_LSHIFT, MOD_LSHIFT },
+  /* F-- ---P 0x41 */ { HID_KEY_RETURN, HID_KEY_ENTER, HID_KEY_RESERVED, HID_KEY_RESERVED, '\n', '\n', '\n' },
+  /* F-- --R- 0x42 */ { HID_KEY_RIGHT_ARROW, HID_KEY_RIGHT_ARROW, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_RIGHTARR, NONBLE_RIGHTARR, NONBLE_RIGHTARR },
+  /* F-- --RP 0x43 */ { HID_KEY_DOWN_ARROW, HID_KEY_DOWN_ARROW, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_DOWNARR, NONBLE_DOWNARR, NONBLE_DOWNARR },
+  /* F-- -M-- 0x44 */ { HID_KEY_DELETE, HID_KEY_DELETE, HID_KEY_DELETE, HID_KEY_RESERVED, NONBLE_BACKSPACE, NONBLE_BACKSPACE, NONBLE_BACKSPACE },
+  /* F-- -M-P 0x45 */ { HID_KEY_PRNT_SCREEN, HID_KEY_PRNT_SCREEN, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- -MR- 0x46 */ { HID_KEY_DELETE_FWD, HID_KEY_DELETE_FWD, MEDIA_playpause, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- -MRP 0x47 */ { HID_KEY_PAGE_DOWN, HID_KEY_PAGE_DOWN, MEDIA_next, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- I--- 0x48 */ { HID_KEY_LEFT_ARROW, HID_KEY_LEFT_ARROW, MEDIA_previous, HID_KEY_RESERVED, NONBLE_LEFTARR, NONBLE_LEFTARR, NONBLE_LEFTARR },
+  /* F-- I--P 0x49 */ { HID_KEY_END, HID_KEY_END, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- I-R- 0x4A */ { HID_KEY_TAB, HID_KEY_TAB, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- I-RP 0x4B */ { HID_KEY_HOME, HID_KEY_HOME, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- IM-- 0x4C */ { HID_KEY_UP_ARROW, HID_KEY_UP_ARROW, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_UPARR, NONBLE_UPARR, NONBLE_UPARR },
+  /* F-- IM-P 0x4D */ { HID_KEY_SCROLL_LOCK, HID_KEY_SCROLL_LOCK, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- IMR- 0x4E */ { HID_KEY_PAGE_UP, HID_KEY_PAGE_UP, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-- IMRP 0x4F */ { HID_KEY_CAPS_LOCK, HID_KEY_CAPS_LOCK, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N ---- 0x50 */ { HID_KEY_PAUSE, HID_KEY_PAUSE, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N ---P 0x51 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N --R- 0x52 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N --RP 0x53 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N -M-- 0x54 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N -M-P 0x55 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N -MR- 0x56 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N -MRP 0x57 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N I--- 0x58 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N I--P 0x59 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N I-R- 0x5A */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N I-RP 0x5B */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N IM-- 0x5C */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N IM-P 0x5D */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N IMR- 0x5E */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* F-N IMRP 0x5F */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- ---- 0x60 */ { MOD_RSHIFT, MOD_RSHIFT, MOD_RSHIFT, HID_KEY_RESERVED, MOD_RSHIFT, MOD_RSHIFT, MOD_RSHIFT },
+  /* FC- ---P 0x61 */ { HID_KEY_ENTER, HID_KEY_ENTER, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- --R- 0x62 */ { HID_KEYPAD_6, HID_KEYPAD_6, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- --RP 0x63 */ { MEDIA_volup, HID_KEYPAD_2, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- -M-- 0x64 */ { MEDIA_stop, HID_KEYPAD_5, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- -M-P 0x65 */ { HID_KEY_MULTIPLY, HID_KEY_MULTIPLY, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- -MR- 0x66 */ { MEDIA_playpause, HID_KEYPAD_DOT, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- -MRP 0x67 */ { MEDIA_next, HID_KEYPAD_3, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- I--- 0x68 */ { HID_KEYPAD_4, HID_KEYPAD_4, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- I--P 0x69 */ { MEDIA_previous, HID_KEYPAD_1, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- I-R- 0x6A */ { HID_KEY_SUBTRACT, HID_KEY_SUBTRACT, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- I-RP 0x6B */ { HID_KEYPAD_7, HID_KEYPAD_7, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- IM-- 0x6C */ { MEDIA_voldn, HID_KEYPAD_8, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- IM-P 0x6D */ { HID_KEY_DIVIDE, HID_KEY_DIVIDE, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- IMR- 0x6E */ { MEDIA_previous, HID_KEYPAD_9, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FC- IMRP 0x6F */ { HID_KEYPAD_0, HID_KEYPAD_0, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN ---- 0x70 */ { MODE_MRESET, MODE_RESET, MODE_RESET, HID_KEY_RESERVED, MODE_MRESET, MODE_MRESET, MODE_RESET },
+  /* FCN ---P 0x71 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN --R- 0x72 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN --RP 0x73 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN -M-- 0x74 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN -M-P 0x75 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN -MR- 0x76 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN -MRP 0x77 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN I--- 0x78 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN I--P 0x79 */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN I-R- 0x7A */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN I-RP 0x7B */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN IM-- 0x7C */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN IM-P 0x7D */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN IMR- 0x7E */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+  /* FCN IMRP 0x7F */ { HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, HID_KEY_RESERVED, NONBLE_NOKEY, NONBLE_NOKEY, NONBLE_NOKEY },
+};
+
+const symbol_t (*keymap)[KEYMAP_LAYERS] = keymap_builtin;
+
+// As per host/effort.c:
+const uint8_t keymap_holdover[KEYMAP_CHORDS][KEYMAP_CHORDS / 8] = {
+  /* --- ---- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* --- ---P */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* --- --R- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* --- --RP */ { 0xE8, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  /* --- -M-- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* --- -M-P */ { 0xE8, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA },
+  /* --- -MR- */ { 0xE8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC },
+  /* --- -MRP */ { 0xE8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
+  /* --- I--- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* --- I--P */ { 0xA8, 0xFE, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF },
+  /* --- I-R- */ { 0xC8, 0xFE, 0xCC, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF },
+  /* --- I-RP */ { 0xE8, 0xFE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF },
+  /* --- IM-- */ { 0xE0, 0xFE, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF },
+  /* --- IM-P */ { 0xE8, 0xFE, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF },
+  /* --- IMR- */ { 0xE8, 0xFE, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF },
+  /* --- IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF },
+  /* --N ---- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* --N ---P */ { 0xA8, 0xAA, 0xFE, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF },
+  /* --N --R- */ { 0xC8, 0xCC, 0xFE, 0xFF, 0xCC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0xFF, 0xFF },
+  /* --N --RP */ { 0xE8, 0xEE, 0xFE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF },
+  /* --N -M-- */ { 0xE0, 0xF0, 0xFE, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF },
+  /* --N -M-P */ { 0xE8, 0xFA, 0xFE, 0xFF, 0xFA, 0xFA, 0xFF, 0xFF, 0xFA, 0xFA, 0xFF, 0xFF, 0xFA, 0xFA, 0xFF, 0xFF },
+  /* --N -MR- */ { 0xE8, 0xFC, 0xFE, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF },
+  /* --N -MRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF },
+  /* --N I--- */ { 0x00, 0xFE, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF },
+  /* --N I--P */ { 0xA8, 0xFE, 0xFE, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF },
+  /* --N I-R- */ { 0xC8, 0xFE, 0xFE, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF },
+  /* --N I-RP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF },
+  /* --N IM-- */ { 0xE0, 0xFE, 0xFE, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF },
+  /* --N IM-P */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF },
+  /* --N IMR- */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF },
+  /* --N IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF },
+  /* -C- ---- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* -C- ---P */ { 0xA8, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- --R- */ { 0xC8, 0xCC, 0xCC, 0xCC, 0xFE, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- --RP */ { 0xE8, 0xEE, 0xEE, 0xEE, 0xFE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- -M-- */ { 0xE0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- -M-P */ { 0xE8, 0xFA, 0xFA, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0xFA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- -MR- */ { 0xE8, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- -MRP */ { 0xE8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- I--- */ { 0x00, 0xFE, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- I--P */ { 0xA8, 0xFE, 0xAA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- I-R- */ { 0xC8, 0xFE, 0xCC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- I-RP */ { 0xE8, 0xFE, 0xEE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- IM-- */ { 0xE0, 0xFE, 0xF0, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- IM-P */ { 0xE8, 0xFE, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- IMR- */ { 0xE8, 0xFE, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -C- IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN ---- */ { 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN ---P */ { 0xA8, 0xAA, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN --R- */ { 0xC8, 0xCC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN --RP */ { 0xE8, 0xEE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN -M-- */ { 0xE0, 0xF0, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN -M-P */ { 0xE8, 0xFA, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN -MR- */ { 0xE8, 0xFC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN -MRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN I--- */ { 0x00, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN I--P */ { 0xA8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN I-R- */ { 0xC8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN I-RP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN IM-- */ { 0xE0, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN IM-P */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN IMR- */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* -CN IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- ---- */ { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  /* F-- ---P */ { 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- --R- */ { 0xC8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- --RP */ { 0xE8, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- -M-- */ { 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- -M-P */ { 0xE8, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- -MR- */ { 0xE8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- -MRP */ { 0xE8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- I--- */ { 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- I--P */ { 0xA8, 0xFE, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- I-R- */ { 0xC8, 0xFE, 0xCC, 0xFF, 0xCC, 0xFF, 0xCC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- I-RP */ { 0xE8, 0xFE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- IM-- */ { 0xE0, 0xFE, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- IM-P */ { 0xE8, 0xFE, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- IMR- */ { 0xE8, 0xFE, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-- IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N ---- */ { 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N ---P */ { 0xA8, 0xAA, 0xFE, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N --R- */ { 0xC8, 0xCC, 0xFE, 0xFF, 0xCC, 0xCC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N --RP */ { 0xE8, 0xEE, 0xFE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N -M-- */ { 0xE0, 0xF0, 0xFE, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N -M-P */ { 0xE8, 0xFA, 0xFE, 0xFF, 0xFA, 0xFA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N -MR- */ { 0xE8, 0xFC, 0xFE, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N -MRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N I--- */ { 0x00, 0xFE, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N I--P */ { 0xA8, 0xFE, 0xFE, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N I-R- */ { 0xC8, 0xFE, 0xFE, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N I-RP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N IM-- */ { 0xE0, 0xFE, 0xFE, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N IM-P */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N IMR- */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* F-N IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- ---- */ { 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- ---P */ { 0xA8, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- --R- */ { 0xC8, 0xCC, 0xCC, 0xCC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- --RP */ { 0xE8, 0xEE, 0xEE, 0xEE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- -M-- */ { 0xE0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- -M-P */ { 0xE8, 0xFA, 0xFA, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- -MR- */ { 0xE8, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- -MRP */ { 0xE8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- I--- */ { 0x00, 0xFE, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- I--P */ { 0xA8, 0xFE, 0xAA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- I-R- */ { 0xC8, 0xFE, 0xCC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- I-RP */ { 0xE8, 0xFE, 0xEE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- IM-- */ { 0xE0, 0xFE, 0xF0, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- IM-P */ { 0xE8, 0xFE, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- IMR- */ { 0xE8, 0xFE, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FC- IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN ---- */ { 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN ---P */ { 0xA8, 0xAA, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN --R- */ { 0xC8, 0xCC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN --RP */ { 0xE8, 0xEE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN -M-- */ { 0xE0, 0xF0, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN -M-P */ { 0xE8, 0xFA, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN -MR- */ { 0xE8, 0xFC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN -MRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN I--- */ { 0x00, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN I--P */ { 0xA8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN I-R- */ { 0xC8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN I-RP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN IM-- */ { 0xE0, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN IM-P */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN IMR- */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+  /* FCN IMRP */ { 0xE8, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+};
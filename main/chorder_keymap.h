@@ -0,0 +1,33 @@
+// Generated by host/keymap_gen from keymap.chords; edit that instead.
+#ifndef _CHORDER_KEYMAP_H_
+#define _CHORDER_KEYMAP_H_
+
+#include "chordmappings.h"
+
+#define KEYMAP_CHORDS 128
+
+// As per keymap_symbols_fingerprint(), for keymap blobs to match:
+#define KEYMAP_SYMBOLS_FINGERPRINT 0x33CCFCC0UL
+
+enum keymap_layer {
+  KEYMAP_ALPHA,
+  KEYMAP_NUMSYM,
+  KEYMAP_FUNCTION,
+  KEYMAP_MOUSE,
+  KEYMAP_NOTE_SHIFTED,
+  KEYMAP_NOTE_UNSHIFTED,
+  KEYMAP_NOTE_NUMSYMED,
+  KEYMAP_LAYERS
+};
+
+// Symbol per chord (as a FCN IMRP keyState) and layer; lives in flash:
+extern const symbol_t keymap_builtin[KEYMAP_CHORDS][KEYMAP_LAYERS];
+
+// The keymap in use: keymap_builtin unless one was loaded at runtime:
+extern const symbol_t (*keymap)[KEYMAP_LAYERS];
+
+// Bit per chord pair, [previous][next / 8] & 1 << next % 8, set where next is
+// less effort typed holding over keys from previous than from scratch:
+extern const uint8_t keymap_holdover[KEYMAP_CHORDS][KEYMAP_CHORDS / 8];
+
+#endif
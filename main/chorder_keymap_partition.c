@@ -0,0 +1,55 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_crc.h"
+
+#include "chorder_keymap_partition.h"
+
+#define KEYMAP_BLOB_SYMBOLS_SIZE (KEYMAP_CHORDS * KEYMAP_LAYERS * sizeof(symbol_t))
+
+void keymap_partition_load(void)
+{
+  const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, KEYMAP_PARTITION_SUBTYPE, NULL);
+  if (NULL == partition) {
+    ESP_LOGI(__FUNCTION__, "No keymap partition; using the built-in keymap");
+    return;
+  }
+  size_t size = sizeof(keymap_blob_header_t) + KEYMAP_BLOB_SYMBOLS_SIZE;
+  if (partition->size < size) {
+    ESP_LOGE(__FUNCTION__, "Keymap partition too small (%u bytes); using the built-in keymap", (unsigned) partition->size);
+    return;
+  }
+
+  // The mapping is kept for good; lookups then read straight from flash:
+  const void *mapped;
+  esp_partition_mmap_handle_t handle;
+  esp_err_t ret = esp_partition_mmap(partition, 0, size, ESP_PARTITION_MMAP_DATA, &mapped, &handle);
+  if (ESP_OK != ret) {
+    ESP_LOGE(__FUNCTION__, "Cannot map the keymap partition (%s); using the built-in keymap", esp_err_to_name(ret));
+    return;
+  }
+  const keymap_blob_header_t *header = mapped;
+  const symbol_t *symbols = (const symbol_t *) (header + 1);
+
+  if (KEYMAP_BLOB_MAGIC != header->magic) {
+    ESP_LOGI(__FUNCTION__, "Keymap partition is empty; using the built-in keymap");
+  } else if (KEYMAP_BLOB_VERSION != header->version) {
+    ESP_LOGE(__FUNCTION__, "Keymap blob is version %u, not %u; using the built-in keymap",
+        header->version, KEYMAP_BLOB_VERSION);
+  } else if (KEYMAP_CHORDS != header->chords || KEYMAP_LAYERS != header->layers) {
+    ESP_LOGE(__FUNCTION__, "Keymap blob has %u chords on %u layers, not %u on %u; using the built-in keymap",
+        header->chords, header->layers, KEYMAP_CHORDS, KEYMAP_LAYERS);
+  } else if (KEYMAP_SYMBOLS_FINGERPRINT != header->fingerprint) {
+    ESP_LOGE(__FUNCTION__, "Keymap blob numbers its symbols differently (%08x, not %08x); using the built-in keymap",
+        (unsigned) header->fingerprint, (unsigned) KEYMAP_SYMBOLS_FINGERPRINT);
+  } else if (header->crc32 != esp_crc32_le(0, (const uint8_t *) symbols, KEYMAP_BLOB_SYMBOLS_SIZE)) {
+    ESP_LOGE(__FUNCTION__, "Keymap blob fails its CRC; using the built-in keymap");
+  } else {
+    char name[KEYMAP_BLOB_NAME_MAX + 1] = { 0 };
+    memcpy(name, header->name, KEYMAP_BLOB_NAME_MAX);
+    ESP_LOGI(__FUNCTION__, "Using keymap \"%s\" from the keymap partition", name);
+    keymap = (const symbol_t (*)[KEYMAP_LAYERS]) symbols;
+    return;
+  }
+  esp_partition_munmap(handle);
+}
@@ -0,0 +1,37 @@
+#ifndef _CHORDER_KEYMAP_PARTITION_H_
+#define _CHORDER_KEYMAP_PARTITION_H_
+
+#include <stdint.h>
+
+#include "chorder_keymap.h"
+
+/* Binary keymaps, as packed by host/keymap_pack, for swapping layouts by
+ * writing the "keymap" data partition rather than reflashing the app.
+ *
+ * A keymap blob is this header, followed by symbol_t symbols[chords][layers]
+ * (little-endian, as on the ESP32). The CRC covers the symbols only; the
+ * fingerprint is that of the symbol numbering they were resolved against,
+ * which changes whenever chordmappings.h or hid_dev.h renumber anything.
+ */
+#define KEYMAP_PARTITION_SUBTYPE  0x40
+#define KEYMAP_BLOB_MAGIC         0x50414D4BUL   // "KMAP"
+#define KEYMAP_BLOB_VERSION       2
+#define KEYMAP_BLOB_NAME_MAX      16
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t chords;
+  uint8_t layers;
+  uint32_t crc32;                          // esp_crc32_le(0, symbols, ...)
+  uint32_t fingerprint;                    // KEYMAP_SYMBOLS_FINGERPRINT
+  char name[KEYMAP_BLOB_NAME_MAX];         // NUL-padded layout name
+} keymap_blob_header_t;
+
+/* Points keymap at the blob in the keymap partition, mapped in place, if it
+ * is intact and matches this firmware's layers and symbols. Otherwise, keymap stays at
+ * keymap_builtin.
+ */
+void keymap_partition_load(void);
+
+#endif
@@ -0,0 +1,56 @@
+#include <string.h>
+
+#include "chorder_keyreport.h"
+
+void keyreport_init(keyreport_t *kr, keyreport_send_t send)
+{
+  memset(kr, 0, sizeof(*kr));
+  kr->send = send;
+}
+
+static bool has_key(const uint8_t *keys, uint8_t count, uint8_t key)
+{
+  for (uint8_t i = 0; i < count; i++) {
+    if (keys[i] == key)
+      return true;
+  }
+  return false;
+}
+
+static void send_packed(keyreport_t *kr)
+{
+  kr->send(kr->mod, kr->keys, kr->count);
+  kr->reports++;
+  memcpy(kr->down, kr->keys, kr->count);
+  kr->down_count = kr->count;
+  kr->count = 0;
+}
+
+static void send_release(keyreport_t *kr)
+{
+  uint8_t none[1] = { 0 };
+  kr->send(0x00, none, 1);
+  kr->reports++;
+  kr->down_count = 0;
+}
+
+void keyreport_tap(keyreport_t *kr, uint8_t mod, uint8_t key)
+{
+  // Whatever's in the report being packed can't take the key any more:
+  if (0 != kr->count && (mod != kr->mod || KEYREPORT_KEYS == kr->count
+        || has_key(kr->keys, kr->count, key) || has_key(kr->down, kr->down_count, key)))
+    send_packed(kr);
+  // A key still down from the report before would be no press at all:
+  if (0 == kr->count && has_key(kr->down, kr->down_count, key))
+    send_release(kr);
+  kr->mod = mod;
+  kr->keys[kr->count++] = key;
+}
+
+void keyreport_flush(keyreport_t *kr)
+{
+  if (0 != kr->count)
+    send_packed(kr);
+  if (0 != kr->down_count)
+    send_release(kr);
+}
@@ -0,0 +1,44 @@
+#ifndef _CHORDER_KEYREPORT_H_
+#define _CHORDER_KEYREPORT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Packs key taps into as few keyboard reports as the host will take them in.
+ * A report has room for six keys (HID_KEYBOARD_IN_RPT_LEN less the modifier
+ * and reserved bytes), and a key newly down in a report is a press to the
+ * host, in the order the report lists them. So consecutive taps of distinct
+ * keys with the same modifiers go out as one report, and going straight on
+ * to the next report releases whatever isn't in it.
+ *
+ * A report is only split on a modifier change, a seventh key, or a key that's
+ * in it already. A release report of its own is only sent where a key would
+ * otherwise stay down from the report before, and at the end. Text comes out
+ * at about one report per six characters, rather than one or two per
+ * character. Reports go to the send function given.
+ */
+#define KEYREPORT_KEYS 6
+
+typedef void (*keyreport_send_t)(uint8_t mod, uint8_t *keys, uint8_t count);
+
+typedef struct {
+  keyreport_send_t send;
+  uint8_t mod;                             // of the report being packed
+  uint8_t keys[KEYREPORT_KEYS];
+  uint8_t count;
+  uint8_t down[KEYREPORT_KEYS];            // as of the last report sent
+  uint8_t down_count;
+  uint32_t reports;                        // sent so far
+} keyreport_t;
+
+void keyreport_init(keyreport_t *kr, keyreport_send_t send);
+
+// Adds a press and release of key, with mod held, sending reports as needed:
+void keyreport_tap(keyreport_t *kr, uint8_t mod, uint8_t key);
+
+/* Sends the report being packed, and a release of every key; e.g. to finish
+ * off, or before sending reports past the packer.
+ */
+void keyreport_flush(keyreport_t *kr);
+
+#endif
@@ -0,0 +1,34 @@
+#include "chorder_keyring.h"
+
+bool key_event_ring_push(key_event_ring_t *ring, const key_event_t *event)
+{
+  uint32_t head = ring->head;
+  uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+  if (head - tail >= KEY_EVENT_RING_SIZE) {
+    __atomic_store_n(&ring->overflows, ring->overflows + 1, __ATOMIC_RELAXED);
+    return false;
+  }
+  ring->events[head & (KEY_EVENT_RING_SIZE - 1)] = *event;
+  // Publish the event only once it's been written:
+  __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool key_event_ring_pop(key_event_ring_t *ring, key_event_t *event)
+{
+  uint32_t tail = ring->tail;
+  uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+  if (head == tail)
+    return false;
+  *event = ring->events[tail & (KEY_EVENT_RING_SIZE - 1)];
+  // Hand the slot back only once it's been read:
+  __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+uint32_t key_event_ring_overflows(const key_event_ring_t *ring)
+{
+  return __atomic_load_n(&ring->overflows, __ATOMIC_RELAXED);
+}
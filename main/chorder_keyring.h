@@ -0,0 +1,33 @@
+#ifndef _CHORDER_KEYRING_H_
+#define _CHORDER_KEYRING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Must be a power of two:
+#define KEY_EVENT_RING_SIZE 64
+
+typedef struct {
+  int64_t timestamp;  // esp_timer_get_time() of the change
+  uint8_t keyState;   // the debounced keyState from then on
+} key_event_t;
+
+/* Single-producer, single-consumer ring of key events, handing debounced
+ * keyStates from the scanner task to the decoder task without locks. Only the
+ * producer may call key_event_ring_push() and only the consumer may call
+ * key_event_ring_pop().
+ */
+typedef struct {
+  key_event_t events[KEY_EVENT_RING_SIZE];
+  uint32_t head;       // next slot to write; written by the producer only
+  uint32_t tail;       // next slot to read; written by the consumer only
+  uint32_t overflows;  // events dropped on a full ring; producer only
+} key_event_ring_t;
+
+// Returns false, counting an overflow, if the ring is full:
+bool key_event_ring_push(key_event_ring_t *ring, const key_event_t *event);
+// Returns false if the ring is empty:
+bool key_event_ring_pop(key_event_ring_t *ring, key_event_t *event);
+uint32_t key_event_ring_overflows(const key_event_ring_t *ring);
+
+#endif
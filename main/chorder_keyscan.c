@@ -0,0 +1,17 @@
+#include "chorder_keyscan.h"
+
+bool keyscan_step(debouncer_t *db, uint8_t *stable, uint8_t raw, const int64_t *edge_times,
+    int64_t now, key_event_ring_t *ring)
+{
+  uint8_t debounced = debounce_update(db, raw, edge_times, now);
+  if (debounced == *stable)
+    return false;
+
+  key_event_t event = {
+    .timestamp = debounce_last_activity(db, *stable ^ debounced),
+    .keyState = debounced,
+  };
+  *stable = debounced;
+  key_event_ring_push(ring, &event);
+  return true;
+}
@@ -0,0 +1,50 @@
+#ifndef _CHORDER_KEYSCAN_H_
+#define _CHORDER_KEYSCAN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/gpio.h"
+#include "config.h"
+#include "chorder_debounce.h"
+#include "chorder_keyring.h"
+
+// Bit positions of each key within a keyState, i.e. FCN IMRP:
+#define F_THUMB_BIT  6
+#define C_THUMB_BIT  5
+#define N_THUMB_BIT  4
+#define INDEX_BIT    3
+#define MIDDLE_BIT   2
+#define RING_BIT     1
+#define PINKY_BIT    0
+
+// Moves a key's level from the GPIO_IN_REG (pins 0-31) or GPIO_IN1_REG (pins
+// 32-39) value into its keyState bit. Keys pull their pin low when pressed.
+// The pins are compile-time constants, so the register choice and the shifts
+// fold down to a mask-and-shift per key.
+#define KEYSCAN_PIN_TO_BIT(in, in1, pin, bit) \
+  ((uint8_t)(((((pin) < 32) ? ((in) >> ((pin) & 31)) : ((in1) >> ((pin) & 31))) & 1) ^ 1) << (bit))
+
+/* Builds the 7-bit keyState from one snapshot of the GPIO input registers.
+ * The registers are read by the caller:
+ */
+static inline uint8_t keystate_from_gpio_in (uint32_t in, uint32_t in1)
+{
+  return KEYSCAN_PIN_TO_BIT(in, in1, F_THUMB_PIN, F_THUMB_BIT)
+       | KEYSCAN_PIN_TO_BIT(in, in1, C_THUMB_PIN, C_THUMB_BIT)
+       | KEYSCAN_PIN_TO_BIT(in, in1, N_THUMB_PIN, N_THUMB_BIT)
+       | KEYSCAN_PIN_TO_BIT(in, in1, INDEX_PIN,   INDEX_BIT)
+       | KEYSCAN_PIN_TO_BIT(in, in1, MIDDLE_PIN,  MIDDLE_BIT)
+       | KEYSCAN_PIN_TO_BIT(in, in1, RING_PIN,    RING_BIT)
+       | KEYSCAN_PIN_TO_BIT(in, in1, PINKY_PIN,   PINKY_BIT);
+}
+
+/* One pass of the scanner task, on a raw keyState read at now: debounces it,
+ * with the last edge per key as timestamped by the edge interrupt handler (or
+ * NULL when polling), and pushes any change to the debounced keyState, stamped
+ * with the edge behind it, onto ring. *stable is the debounced keyState as of
+ * the pass before, and is updated. Returns whether it changed.
+ */
+bool keyscan_step(debouncer_t *db, uint8_t *stable, uint8_t raw, const int64_t *edge_times,
+    int64_t now, key_event_ring_t *ring);
+
+#endif
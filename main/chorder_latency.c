@@ -0,0 +1,119 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "chorder_latency.h"
+
+static const char *stage_names[LATENCY_STAGES] = {
+  [LATENCY_EDGE_TO_DECODE]   = "edge->decode",
+  [LATENCY_DECODE_TO_NOTIFY] = "decode->notify",
+  [LATENCY_EDGE_TO_NOTIFY]   = "edge->notify",
+};
+
+typedef struct {
+  uint32_t buckets[LATENCY_BUCKETS];
+  uint32_t count;
+  int64_t max;
+} latency_histogram_t;
+
+static latency_histogram_t histograms[LATENCY_STAGES];
+
+// Timestamps of the chord decided upon, until its first report is queued;
+// zero when there's none. Only touched by the decoder:
+static int64_t pending_edge = 0;
+static int64_t pending_decode = 0;
+
+static inline unsigned bucket_for(int64_t us)
+{
+  if (us <= 0)
+    return 0;
+  if (us >= (1LL << (LATENCY_BUCKETS - 2)))
+    return LATENCY_BUCKETS - 1;
+  return 32 - __builtin_clz((uint32_t) us);
+}
+
+void latency_record(latency_stage_t stage, int64_t us)
+{
+  latency_histogram_t *h = &histograms[stage];
+  h->buckets[bucket_for(us)]++;
+  h->count++;
+  if (us > h->max)
+    h->max = us;
+}
+
+void latency_mark_edge(int64_t edge_time)
+{
+  pending_edge = edge_time;
+  pending_decode = 0;
+}
+
+void latency_mark_decode(void)
+{
+  if (0 == pending_edge)
+    return;
+  pending_decode = esp_timer_get_time();
+  latency_record(LATENCY_EDGE_TO_DECODE, pending_decode - pending_edge);
+}
+
+void latency_take_decode(int64_t *edge_time, int64_t *decode_time)
+{
+  // Only the first report after a decode counts:
+  *edge_time = 0 != pending_decode ? pending_edge : 0;
+  *decode_time = pending_decode;
+  if (0 != pending_decode) {
+    pending_edge = 0;
+    pending_decode = 0;
+  }
+}
+
+void latency_mark_notify(int64_t edge_time, int64_t decode_time)
+{
+  if (0 == decode_time)
+    return;
+  int64_t now = esp_timer_get_time();
+  latency_record(LATENCY_DECODE_TO_NOTIFY, now - decode_time);
+  latency_record(LATENCY_EDGE_TO_NOTIFY, now - edge_time);
+}
+
+int64_t latency_percentile(latency_stage_t stage, unsigned percentile)
+{
+  const latency_histogram_t *h = &histograms[stage];
+  if (0 == h->count)
+    return -1;
+
+  // Rank of the sample we're after, rounding up:
+  uint64_t rank = ((uint64_t) h->count * percentile + 99) / 100;
+  uint64_t seen = 0;
+  for (unsigned i = 0; i < LATENCY_BUCKETS; i++) {
+    seen += h->buckets[i];
+    if (seen >= rank && 0 != seen)
+      return i == LATENCY_BUCKETS - 1 ? h->max : (1LL << i) - 1;
+  }
+  return h->max;
+}
+
+void latency_dump(void)
+{
+  for (unsigned stage = 0; stage < LATENCY_STAGES; stage++) {
+    const latency_histogram_t *h = &histograms[stage];
+    ESP_LOGI(__FUNCTION__, "%-14s n=%u p50<=%lldus p99<=%lldus max=%lldus",
+        stage_names[stage], (unsigned) h->count,
+        (long long) latency_percentile(stage, 50),
+        (long long) latency_percentile(stage, 99),
+        (long long) h->max);
+    for (unsigned i = 0; i < LATENCY_BUCKETS; i++) {
+      if (0 == h->buckets[i])
+        continue;
+      ESP_LOGI(__FUNCTION__, "  %10lldus..%10lldus: %u",
+          i ? (1LL << (i - 1)) : 0LL,
+          i == LATENCY_BUCKETS - 1 ? (long long) h->max : (1LL << i) - 1,
+          (unsigned) h->buckets[i]);
+    }
+  }
+}
+
+void latency_reset(void)
+{
+  memset(histograms, 0, sizeof(histograms));
+  pending_edge = 0;
+  pending_decode = 0;
+}
@@ -0,0 +1,37 @@
+#ifndef _CHORDER_LATENCY_H_
+#define _CHORDER_LATENCY_H_
+
+#include <stdint.h>
+
+// Bucket i counts latencies in [2^(i-1), 2^i) microseconds; bucket 0 is 0us:
+#define LATENCY_BUCKETS 32
+
+typedef enum {
+  LATENCY_EDGE_TO_DECODE,    // physical key edge until the chord is decided upon
+  LATENCY_DECODE_TO_NOTIFY,  // chord decided upon until the first BLE notification
+  LATENCY_EDGE_TO_NOTIFY,    // the two above, end to end
+  LATENCY_STAGES
+} latency_stage_t;
+
+/* Always-on press-to-notify instrumentation. The decoder marks the edge that
+ * triggered a chord and its decode decision; the first report it queues after
+ * that carries both timestamps through the HID transmit queue, which marks the
+ * notification as it goes out. Each leg lands in a log2-bucketed histogram.
+ */
+void latency_mark_edge(int64_t edge_time);
+void latency_mark_decode(void);
+// Takes the timestamps of the chord decided upon, for the report about to be
+// queued; both are 0 if there's none, or they've already been taken. Only for
+// the decoder's own reports:
+void latency_take_decode(int64_t *edge_time, int64_t *decode_time);
+// A report carrying the timestamps of its chord has gone out:
+void latency_mark_notify(int64_t edge_time, int64_t decode_time);
+
+void latency_record(latency_stage_t stage, int64_t us);
+// Upper bound (in us) of the bucket holding the given percentile, or -1 if empty:
+int64_t latency_percentile(latency_stage_t stage, unsigned percentile);
+// Logs count, p50, p99 and max per stage, plus the raw buckets:
+void latency_dump(void);
+void latency_reset(void);
+
+#endif
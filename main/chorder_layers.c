@@ -0,0 +1,121 @@
+#include "chorder_layers.h"
+
+#define KIND(kind) (1 << (kind))
+
+static void resolve_top(layer_stack_t *ls)
+{
+  ls->top = 0 == ls->depth ? ls->base : ls->entries[ls->depth - 1].layer;
+  ls->held_keys = 0;
+  for (uint8_t i = 0; i < ls->depth; i++) {
+    if (ls->entries[i].kinds & KIND(LAYER_MOMENTARY))
+      ls->held_keys |= ls->entries[i].keys;
+  }
+}
+
+static int find_entry(const layer_stack_t *ls, uint8_t layer)
+{
+  for (int i = 0; i < ls->depth; i++) {
+    if (ls->entries[i].layer == layer)
+      return i;
+  }
+  return -1;
+}
+
+// Clears kinds off every entry (and keys off momentary ones), dropping the
+// entries nothing holds any more:
+static void release_kinds(layer_stack_t *ls, uint8_t kinds, uint8_t keyState)
+{
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < ls->depth; i++) {
+    layer_entry_t entry = ls->entries[i];
+    entry.kinds &= ~(kinds & ~KIND(LAYER_MOMENTARY));
+    if ((kinds & KIND(LAYER_MOMENTARY)) && 0 == (entry.keys & keyState))
+      entry.kinds &= ~KIND(LAYER_MOMENTARY);
+    if (0 != entry.kinds)
+      ls->entries[kept++] = entry;
+  }
+  ls->depth = kept;
+  resolve_top(ls);
+}
+
+void layers_reset(layer_stack_t *ls)
+{
+  ls->depth = 0;
+  resolve_top(ls);
+}
+
+void layers_push(layer_stack_t *ls, uint8_t layer, layer_kind_t kind, uint8_t keys)
+{
+  layer_entry_t entry = {
+    .layer = layer,
+    .kinds = 0,
+    .keys = 0,
+  };
+  int i = find_entry(ls, layer);
+  if (-1 != i) {
+    entry = ls->entries[i];
+    for (; i + 1 < ls->depth; i++)
+      ls->entries[i] = ls->entries[i + 1];
+    ls->depth--;
+  }
+  entry.kinds |= KIND(kind);
+  if (LAYER_MOMENTARY == kind)
+    entry.keys = keys;
+  // Every layer appears at most once, so the stack can't overflow:
+  ls->entries[ls->depth++] = entry;
+  resolve_top(ls);
+}
+
+void layers_remove(layer_stack_t *ls, uint8_t layer)
+{
+  int i = find_entry(ls, layer);
+  if (-1 == i)
+    return;
+  for (; i + 1 < ls->depth; i++)
+    ls->entries[i] = ls->entries[i + 1];
+  ls->depth--;
+  resolve_top(ls);
+}
+
+bool layers_has(const layer_stack_t *ls, uint8_t layer, layer_kind_t kind)
+{
+  int i = find_entry(ls, layer);
+  return -1 != i && (ls->entries[i].kinds & KIND(kind));
+}
+
+void layers_oneshot_toggle(layer_stack_t *ls, uint8_t layer)
+{
+  if (ls->top != layer) {
+    layers_push(ls, layer, LAYER_ONESHOT, 0);
+  } else if (0 != ls->depth && KIND(LAYER_ONESHOT) == ls->entries[ls->depth - 1].kinds) {
+    layers_remove(ls, layer);
+  } else if (0 != ls->depth) {
+    layers_push(ls, ls->base, LAYER_ONESHOT, 0);
+  }
+}
+
+void layers_toggle(layer_stack_t *ls, uint8_t layer)
+{
+  if (layers_has(ls, layer, LAYER_TOGGLE))
+    layers_remove(ls, layer);
+  else
+    layers_push(ls, layer, LAYER_TOGGLE, 0);
+}
+
+void layers_lock_toggle(layer_stack_t *ls, uint8_t layer)
+{
+  if (layers_has(ls, layer, LAYER_LOCKED))
+    layers_remove(ls, layer);
+  else
+    layers_push(ls, layer, LAYER_LOCKED, 0);
+}
+
+void layers_key_sent(layer_stack_t *ls)
+{
+  release_kinds(ls, KIND(LAYER_ONESHOT), 0);
+}
+
+void layers_keys_held(layer_stack_t *ls, uint8_t keyState)
+{
+  release_kinds(ls, KIND(LAYER_MOMENTARY), keyState);
+}
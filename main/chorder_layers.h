@@ -0,0 +1,69 @@
+#ifndef _CHORDER_LAYERS_H_
+#define _CHORDER_LAYERS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "chorder_keymap.h"
+
+typedef enum {
+  LAYER_MOMENTARY,   // until the keys of the chord that pushed it are all up,
+                     // which are left out of chords looked up meanwhile
+  LAYER_ONESHOT,     // for the next key sent only
+  LAYER_TOGGLE,      // until pushed again
+  LAYER_LOCKED,      // until unlocked, or the stack is reset
+} layer_kind_t;
+
+/* A stack of keymap layers over a base layer; the most recently pushed layer
+ * still active is the one chords are looked up on. A layer is on the stack
+ * at most once, for as long as any of the kinds it was pushed as holds. The
+ * top of the stack is resolved whenever the stack changes, so a lookup is a
+ * single table load.
+ *
+ * Each operating mode keeps its own stack, so that e.g. a pending shift in
+ * note-taking doesn't carry over into BLE keyboard mode.
+ */
+typedef struct {
+  uint8_t layer;                           // enum keymap_layer
+  uint8_t kinds;                           // bit per layer_kind_t holding it
+  uint8_t keys;                            // keyState holding a momentary layer
+} layer_entry_t;
+
+typedef struct {
+  uint8_t base;                            // looked up on with nothing pushed
+  uint8_t top;                             // the layer lookups currently go to
+  uint8_t held_keys;                       // keys holding momentary layers
+  uint8_t depth;
+  layer_entry_t entries[KEYMAP_LAYERS];
+} layer_stack_t;
+
+#define LAYER_STACK_INIT(base_layer) { .base = (base_layer), .top = (base_layer), .held_keys = 0, .depth = 0 }
+
+static inline symbol_t layers_lookup(const layer_stack_t *ls, uint8_t keyState)
+{
+  return keymap[keyState & ~ls->held_keys][ls->top];
+}
+
+// Pops everything, leaving just the base layer:
+void layers_reset(layer_stack_t *ls);
+
+// Moves layer to the top of the stack, adding kind to what holds it there.
+// keys is the chord holding a momentary layer, and is ignored otherwise:
+void layers_push(layer_stack_t *ls, uint8_t layer, layer_kind_t kind, uint8_t keys);
+void layers_remove(layer_stack_t *ls, uint8_t layer);
+bool layers_has(const layer_stack_t *ls, uint8_t layer, layer_kind_t kind);
+
+/* A one-shot that a second press cancels. If layer is on top for longer than
+ * a one-shot, the base layer is pushed as a one-shot over it instead.
+ */
+void layers_oneshot_toggle(layer_stack_t *ls, uint8_t layer);
+// Toggles or locks layer, or takes it off the stack if it already was:
+void layers_toggle(layer_stack_t *ls, uint8_t layer);
+void layers_lock_toggle(layer_stack_t *ls, uint8_t layer);
+
+// A key was sent: one-shot layers have been used up:
+void layers_key_sent(layer_stack_t *ls);
+// The debounced keyState changed: momentary layers lapse once their keys are up:
+void layers_keys_held(layer_stack_t *ls, uint8_t keyState);
+
+#endif
@@ -0,0 +1,76 @@
+#include "esp_log.h"
+
+#include "chorder_locale.h"
+
+const locale_table_t *active_locale = &locale_tables[0];
+
+bool locale_select(uint8_t id)
+{
+  if (id >= LOCALES) {
+    ESP_LOGE(__FUNCTION__, "No locale %u; typing as %s", id, active_locale->name);
+    return false;
+  }
+  active_locale = &locale_tables[id];
+  ESP_LOGI(__FUNCTION__, "Typing as %s", active_locale->name);
+  return true;
+}
+
+const locale_stroke_t *locale_lookup_extra(uint32_t codepoint)
+{
+  const locale_extra_t *extras = active_locale->extras;
+  size_t low = 0, high = active_locale->extras_len;
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (extras[mid].codepoint < codepoint)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  if (low < active_locale->extras_len && extras[low].codepoint == codepoint)
+    return &extras[low].stroke;
+  return NULL;
+}
+
+uint32_t locale_utf8_next(const char **text, size_t len)
+{
+  const unsigned char *s = (const unsigned char *) *text;
+  uint32_t codepoint;
+  size_t more;
+  if (s[0] < 0x80) {
+    codepoint = s[0];
+    more = 0;
+  } else if ((s[0] & 0xE0) == 0xC0) {
+    codepoint = s[0] & 0x1F;
+    more = 1;
+  } else if ((s[0] & 0xF0) == 0xE0) {
+    codepoint = s[0] & 0x0F;
+    more = 2;
+  } else if ((s[0] & 0xF8) == 0xF0) {
+    codepoint = s[0] & 0x07;
+    more = 3;
+  } else {
+    (*text)++;
+    return 0xFFFD;
+  }
+  if (more >= len) {
+    (*text)++;
+    return 0xFFFD;
+  }
+  for (size_t i = 1; i <= more; i++) {
+    if ((s[i] & 0xC0) != 0x80) {
+      (*text)++;
+      return 0xFFFD;
+    }
+    codepoint = codepoint << 6 | (s[i] & 0x3F);
+  }
+  *text += 1 + more;
+  return codepoint;
+}
+
+size_t locale_utf8_length(const char *text, size_t len)
+{
+  size_t chars = 0;
+  for (size_t i = 0; i < len; i++)
+    chars += ((unsigned char) text[i] & 0xC0) != 0x80;
+  return chars;
+}
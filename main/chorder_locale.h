@@ -0,0 +1,64 @@
+#ifndef _CHORDER_LOCALE_H_
+#define _CHORDER_LOCALE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chorder_locale_tables.h"
+
+/* Typing text on hosts set to other keyboard layouts than US: which key,
+ * with which modifiers, and after which dead key, types each character. The
+ * tables are generated by host/locale_gen from main/locales/<name>.layout; which
+ * one's used is picked at runtime, from the "locale" NVS setting.
+ *
+ * ASCII is looked up directly. The few dozen other characters a layout has
+ * are binary searched for, in a table sorted by code point.
+ */
+typedef struct {
+  uint8_t mod;                             // modifier byte, as in the HID report
+  uint8_t key;                             // 0 if there's no way to type it
+  uint8_t dead_mod;
+  uint8_t dead_key;                        // dead key to type first, or 0
+} locale_stroke_t;
+
+typedef struct {
+  uint16_t codepoint;
+  locale_stroke_t stroke;
+} locale_extra_t;
+
+typedef struct {
+  const char *name;
+  locale_stroke_t ascii[128];
+  uint16_t extras_len;
+  const locale_extra_t *extras;            // by code point
+} locale_table_t;
+
+extern const locale_table_t locale_tables[LOCALES];
+extern const locale_table_t *active_locale;
+
+// Picks the locale to type in, by enum locale; false, leaving it be, if
+// there's no such locale:
+bool locale_select(uint8_t id);
+
+const locale_stroke_t *locale_lookup_extra(uint32_t codepoint);
+
+// How to type codepoint in the active locale; NULL if it can't be typed:
+static inline const locale_stroke_t *locale_lookup(uint32_t codepoint)
+{
+  if (codepoint < 128) {
+    const locale_stroke_t *stroke = &active_locale->ascii[codepoint];
+    return 0 != stroke->key ? stroke : NULL;
+  }
+  return locale_lookup_extra(codepoint);
+}
+
+/* Decodes the UTF-8 character at *text, of no more than len bytes, and moves
+ * *text past it. Malformed sequences come out as U+FFFD a byte at a time.
+ */
+uint32_t locale_utf8_next(const char **text, size_t len);
+
+// Characters in UTF-8 text, e.g. for backspacing over it:
+size_t locale_utf8_length(const char *text, size_t len);
+
+#endif
@@ -0,0 +1,585 @@
+// Generated by host/locale_gen from us.layout, de.layout, dk.layout, fr.layout; edit those instead.
+#include "hid_dev.h"
+#include "chorder_locale.h"
+
+static const locale_extra_t de_extras[] = {
+  { 0x00A7, { .mod = 0x02, .key = HID_KEY_3 } },  // §
+  { 0x00B0, { .mod = 0x02, .key = HID_KEY_GRV_ACCENT } },  // °
+  { 0x00B2, { .mod = 0x40, .key = HID_KEY_2 } },  // ²
+  { 0x00B3, { .mod = 0x40, .key = HID_KEY_3 } },  // ³
+  { 0x00B4, { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ´
+  { 0x00B5, { .mod = 0x40, .key = HID_KEY_M } },  // µ
+  { 0x00C0, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // À
+  { 0x00C1, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Á
+  { 0x00C2, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // Â
+  { 0x00C4, { .mod = 0x02, .key = HID_KEY_SGL_QUOTE } },  // Ä
+  { 0x00C8, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // È
+  { 0x00C9, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // É
+  { 0x00CA, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // Ê
+  { 0x00CC, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // Ì
+  { 0x00CD, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Í
+  { 0x00CE, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // Î
+  { 0x00D2, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // Ò
+  { 0x00D3, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Ó
+  { 0x00D4, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // Ô
+  { 0x00D6, { .mod = 0x02, .key = HID_KEY_SEMI_COLON } },  // Ö
+  { 0x00D9, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // Ù
+  { 0x00DA, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Ú
+  { 0x00DB, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // Û
+  { 0x00DC, { .mod = 0x02, .key = HID_KEY_LEFT_BRKT } },  // Ü
+  { 0x00DD, { .mod = 0x02, .key = HID_KEY_Z, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Ý
+  { 0x00DF, { .mod = 0x00, .key = HID_KEY_MINUS } },  // ß
+  { 0x00E0, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // à
+  { 0x00E1, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // á
+  { 0x00E2, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // â
+  { 0x00E4, { .mod = 0x00, .key = HID_KEY_SGL_QUOTE } },  // ä
+  { 0x00E8, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // è
+  { 0x00E9, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // é
+  { 0x00EA, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // ê
+  { 0x00EC, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // ì
+  { 0x00ED, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // í
+  { 0x00EE, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // î
+  { 0x00F2, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // ò
+  { 0x00F3, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ó
+  { 0x00F4, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // ô
+  { 0x00F6, { .mod = 0x00, .key = HID_KEY_SEMI_COLON } },  // ö
+  { 0x00F9, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // ù
+  { 0x00FA, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ú
+  { 0x00FB, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT } },  // û
+  { 0x00FC, { .mod = 0x00, .key = HID_KEY_LEFT_BRKT } },  // ü
+  { 0x00FD, { .mod = 0x00, .key = HID_KEY_Z, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ý
+  { 0x20AC, { .mod = 0x40, .key = HID_KEY_E } },  // €
+};
+
+static const locale_extra_t dk_extras[] = {
+  { 0x00A3, { .mod = 0x40, .key = HID_KEY_3 } },  // £
+  { 0x00A4, { .mod = 0x02, .key = HID_KEY_4 } },  // ¤
+  { 0x00A7, { .mod = 0x02, .key = HID_KEY_GRV_ACCENT } },  // §
+  { 0x00A8, { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ¨
+  { 0x00B4, { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ´
+  { 0x00B5, { .mod = 0x40, .key = HID_KEY_M } },  // µ
+  { 0x00BD, { .mod = 0x00, .key = HID_KEY_GRV_ACCENT } },  // ½
+  { 0x00C0, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // À
+  { 0x00C1, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Á
+  { 0x00C2, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // Â
+  { 0x00C3, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ã
+  { 0x00C4, { .mod = 0x02, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ä
+  { 0x00C5, { .mod = 0x02, .key = HID_KEY_LEFT_BRKT } },  // Å
+  { 0x00C6, { .mod = 0x02, .key = HID_KEY_SEMI_COLON } },  // Æ
+  { 0x00C8, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // È
+  { 0x00C9, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // É
+  { 0x00CA, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ê
+  { 0x00CB, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ë
+  { 0x00CC, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // Ì
+  { 0x00CD, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Í
+  { 0x00CE, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // Î
+  { 0x00CF, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ï
+  { 0x00D1, { .mod = 0x02, .key = HID_KEY_N, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ñ
+  { 0x00D2, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // Ò
+  { 0x00D3, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Ó
+  { 0x00D4, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ô
+  { 0x00D5, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT } },  // Õ
+  { 0x00D6, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ö
+  { 0x00D8, { .mod = 0x02, .key = HID_KEY_SGL_QUOTE } },  // Ø
+  { 0x00D9, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // Ù
+  { 0x00DA, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Ú
+  { 0x00DB, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // Û
+  { 0x00DC, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // Ü
+  { 0x00DD, { .mod = 0x02, .key = HID_KEY_Y, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // Ý
+  { 0x00E0, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // à
+  { 0x00E1, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // á
+  { 0x00E2, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // â
+  { 0x00E3, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT } },  // ã
+  { 0x00E4, { .mod = 0x00, .key = HID_KEY_A, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ä
+  { 0x00E5, { .mod = 0x00, .key = HID_KEY_LEFT_BRKT } },  // å
+  { 0x00E6, { .mod = 0x00, .key = HID_KEY_SEMI_COLON } },  // æ
+  { 0x00E8, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // è
+  { 0x00E9, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // é
+  { 0x00EA, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // ê
+  { 0x00EB, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ë
+  { 0x00EC, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // ì
+  { 0x00ED, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // í
+  { 0x00EE, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // î
+  { 0x00EF, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ï
+  { 0x00F1, { .mod = 0x00, .key = HID_KEY_N, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT } },  // ñ
+  { 0x00F2, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // ò
+  { 0x00F3, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ó
+  { 0x00F4, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // ô
+  { 0x00F5, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT } },  // õ
+  { 0x00F6, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ö
+  { 0x00F8, { .mod = 0x00, .key = HID_KEY_SGL_QUOTE } },  // ø
+  { 0x00F9, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL } },  // ù
+  { 0x00FA, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ú
+  { 0x00FB, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT } },  // û
+  { 0x00FC, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ü
+  { 0x00FD, { .mod = 0x00, .key = HID_KEY_Y, .dead_mod = 0x00, .dead_key = HID_KEY_EQUAL } },  // ý
+  { 0x00FF, { .mod = 0x00, .key = HID_KEY_Y, .dead_mod = 0x00, .dead_key = HID_KEY_RIGHT_BRKT } },  // ÿ
+  { 0x20AC, { .mod = 0x40, .key = HID_KEY_5 } },  // €
+};
+
+static const locale_extra_t fr_extras[] = {
+  { 0x00A3, { .mod = 0x02, .key = HID_KEY_RIGHT_BRKT } },  // £
+  { 0x00A4, { .mod = 0x40, .key = HID_KEY_RIGHT_BRKT } },  // ¤
+  { 0x00A7, { .mod = 0x02, .key = HID_KEY_FWD_SLASH } },  // §
+  { 0x00A8, { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ¨
+  { 0x00B0, { .mod = 0x02, .key = HID_KEY_MINUS } },  // °
+  { 0x00B2, { .mod = 0x00, .key = HID_KEY_GRV_ACCENT } },  // ²
+  { 0x00B5, { .mod = 0x02, .key = HID_KEY_NONUS_HASH } },  // µ
+  { 0x00C0, { .mod = 0x02, .key = HID_KEY_Q, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // À
+  { 0x00C2, { .mod = 0x02, .key = HID_KEY_Q, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // Â
+  { 0x00C3, { .mod = 0x02, .key = HID_KEY_Q, .dead_mod = 0x40, .dead_key = HID_KEY_2 } },  // Ã
+  { 0x00C4, { .mod = 0x02, .key = HID_KEY_Q, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // Ä
+  { 0x00C8, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // È
+  { 0x00CA, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // Ê
+  { 0x00CB, { .mod = 0x02, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // Ë
+  { 0x00CC, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // Ì
+  { 0x00CE, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // Î
+  { 0x00CF, { .mod = 0x02, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // Ï
+  { 0x00D1, { .mod = 0x02, .key = HID_KEY_N, .dead_mod = 0x40, .dead_key = HID_KEY_2 } },  // Ñ
+  { 0x00D2, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // Ò
+  { 0x00D4, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // Ô
+  { 0x00D5, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x40, .dead_key = HID_KEY_2 } },  // Õ
+  { 0x00D6, { .mod = 0x02, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // Ö
+  { 0x00D9, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // Ù
+  { 0x00DB, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // Û
+  { 0x00DC, { .mod = 0x02, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // Ü
+  { 0x00E0, { .mod = 0x00, .key = HID_KEY_0 } },  // à
+  { 0x00E2, { .mod = 0x00, .key = HID_KEY_Q, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // â
+  { 0x00E3, { .mod = 0x00, .key = HID_KEY_Q, .dead_mod = 0x40, .dead_key = HID_KEY_2 } },  // ã
+  { 0x00E4, { .mod = 0x00, .key = HID_KEY_Q, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ä
+  { 0x00E7, { .mod = 0x00, .key = HID_KEY_9 } },  // ç
+  { 0x00E8, { .mod = 0x00, .key = HID_KEY_7 } },  // è
+  { 0x00E9, { .mod = 0x00, .key = HID_KEY_2 } },  // é
+  { 0x00EA, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // ê
+  { 0x00EB, { .mod = 0x00, .key = HID_KEY_E, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ë
+  { 0x00EC, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // ì
+  { 0x00EE, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // î
+  { 0x00EF, { .mod = 0x00, .key = HID_KEY_I, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ï
+  { 0x00F1, { .mod = 0x00, .key = HID_KEY_N, .dead_mod = 0x40, .dead_key = HID_KEY_2 } },  // ñ
+  { 0x00F2, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x40, .dead_key = HID_KEY_7 } },  // ò
+  { 0x00F4, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // ô
+  { 0x00F5, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x40, .dead_key = HID_KEY_2 } },  // õ
+  { 0x00F6, { .mod = 0x00, .key = HID_KEY_O, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ö
+  { 0x00F9, { .mod = 0x00, .key = HID_KEY_SGL_QUOTE } },  // ù
+  { 0x00FB, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x00, .dead_key = HID_KEY_LEFT_BRKT } },  // û
+  { 0x00FC, { .mod = 0x00, .key = HID_KEY_U, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ü
+  { 0x00FF, { .mod = 0x00, .key = HID_KEY_Y, .dead_mod = 0x02, .dead_key = HID_KEY_LEFT_BRKT } },  // ÿ
+  { 0x20AC, { .mod = 0x40, .key = HID_KEY_E } },  // €
+};
+
+const locale_table_t locale_tables[LOCALES] = {
+  {
+    .name = "us",
+    .ascii = {
+      [0x09] = { .mod = 0x00, .key = HID_KEY_TAB },
+      [0x0A] = { .mod = 0x00, .key = HID_KEY_RETURN },
+      [0x20] = { .mod = 0x00, .key = HID_KEY_SPACEBAR },
+      [0x21] = { .mod = 0x02, .key = HID_KEY_1 },  // !
+      [0x22] = { .mod = 0x02, .key = HID_KEY_SGL_QUOTE },  // "
+      [0x23] = { .mod = 0x02, .key = HID_KEY_3 },  // #
+      [0x24] = { .mod = 0x02, .key = HID_KEY_4 },  // $
+      [0x25] = { .mod = 0x02, .key = HID_KEY_5 },  // %
+      [0x26] = { .mod = 0x02, .key = HID_KEY_7 },  // &
+      [0x27] = { .mod = 0x00, .key = HID_KEY_SGL_QUOTE },  // '
+      [0x28] = { .mod = 0x02, .key = HID_KEY_9 },  // (
+      [0x29] = { .mod = 0x02, .key = HID_KEY_0 },  // )
+      [0x2A] = { .mod = 0x02, .key = HID_KEY_8 },  // *
+      [0x2B] = { .mod = 0x02, .key = HID_KEY_EQUAL },  // +
+      [0x2C] = { .mod = 0x00, .key = HID_KEY_COMMA },  // ,
+      [0x2D] = { .mod = 0x00, .key = HID_KEY_MINUS },  // -
+      [0x2E] = { .mod = 0x00, .key = HID_KEY_DOT },  // .
+      [0x2F] = { .mod = 0x00, .key = HID_KEY_FWD_SLASH },  // /
+      [0x30] = { .mod = 0x00, .key = HID_KEY_0 },  // 0
+      [0x31] = { .mod = 0x00, .key = HID_KEY_1 },  // 1
+      [0x32] = { .mod = 0x00, .key = HID_KEY_2 },  // 2
+      [0x33] = { .mod = 0x00, .key = HID_KEY_3 },  // 3
+      [0x34] = { .mod = 0x00, .key = HID_KEY_4 },  // 4
+      [0x35] = { .mod = 0x00, .key = HID_KEY_5 },  // 5
+      [0x36] = { .mod = 0x00, .key = HID_KEY_6 },  // 6
+      [0x37] = { .mod = 0x00, .key = HID_KEY_7 },  // 7
+      [0x38] = { .mod = 0x00, .key = HID_KEY_8 },  // 8
+      [0x39] = { .mod = 0x00, .key = HID_KEY_9 },  // 9
+      [0x3A] = { .mod = 0x02, .key = HID_KEY_SEMI_COLON },  // :
+      [0x3B] = { .mod = 0x00, .key = HID_KEY_SEMI_COLON },  // ;
+      [0x3C] = { .mod = 0x02, .key = HID_KEY_COMMA },  // <
+      [0x3D] = { .mod = 0x00, .key = HID_KEY_EQUAL },  // =
+      [0x3E] = { .mod = 0x02, .key = HID_KEY_DOT },  // >
+      [0x3F] = { .mod = 0x02, .key = HID_KEY_FWD_SLASH },  // ?
+      [0x40] = { .mod = 0x02, .key = HID_KEY_2 },  // @
+      [0x41] = { .mod = 0x02, .key = HID_KEY_A },  // A
+      [0x42] = { .mod = 0x02, .key = HID_KEY_B },  // B
+      [0x43] = { .mod = 0x02, .key = HID_KEY_C },  // C
+      [0x44] = { .mod = 0x02, .key = HID_KEY_D },  // D
+      [0x45] = { .mod = 0x02, .key = HID_KEY_E },  // E
+      [0x46] = { .mod = 0x02, .key = HID_KEY_F },  // F
+      [0x47] = { .mod = 0x02, .key = HID_KEY_G },  // G
+      [0x48] = { .mod = 0x02, .key = HID_KEY_H },  // H
+      [0x49] = { .mod = 0x02, .key = HID_KEY_I },  // I
+      [0x4A] = { .mod = 0x02, .key = HID_KEY_J },  // J
+      [0x4B] = { .mod = 0x02, .key = HID_KEY_K },  // K
+      [0x4C] = { .mod = 0x02, .key = HID_KEY_L },  // L
+      [0x4D] = { .mod = 0x02, .key = HID_KEY_M },  // M
+      [0x4E] = { .mod = 0x02, .key = HID_KEY_N },  // N
+      [0x4F] = { .mod = 0x02, .key = HID_KEY_O },  // O
+      [0x50] = { .mod = 0x02, .key = HID_KEY_P },  // P
+      [0x51] = { .mod = 0x02, .key = HID_KEY_Q },  // Q
+      [0x52] = { .mod = 0x02, .key = HID_KEY_R },  // R
+      [0x53] = { .mod = 0x02, .key = HID_KEY_S },  // S
+      [0x54] = { .mod = 0x02, .key = HID_KEY_T },  // T
+      [0x55] = { .mod = 0x02, .key = HID_KEY_U },  // U
+      [0x56] = { .mod = 0x02, .key = HID_KEY_V },  // V
+      [0x57] = { .mod = 0x02, .key = HID_KEY_W },  // W
+      [0x58] = { .mod = 0x02, .key = HID_KEY_X },  // X
+      [0x59] = { .mod = 0x02, .key = HID_KEY_Y },  // Y
+      [0x5A] = { .mod = 0x02, .key = HID_KEY_Z },  // Z
+      [0x5B] = { .mod = 0x00, .key = HID_KEY_LEFT_BRKT },  // [
+      [0x5C] = { .mod = 0x00, .key = HID_KEY_BACK_SLASH },
+      [0x5D] = { .mod = 0x00, .key = HID_KEY_RIGHT_BRKT },  // ]
+      [0x5E] = { .mod = 0x02, .key = HID_KEY_6 },  // ^
+      [0x5F] = { .mod = 0x02, .key = HID_KEY_MINUS },  // _
+      [0x60] = { .mod = 0x00, .key = HID_KEY_GRV_ACCENT },  // `
+      [0x61] = { .mod = 0x00, .key = HID_KEY_A },  // a
+      [0x62] = { .mod = 0x00, .key = HID_KEY_B },  // b
+      [0x63] = { .mod = 0x00, .key = HID_KEY_C },  // c
+      [0x64] = { .mod = 0x00, .key = HID_KEY_D },  // d
+      [0x65] = { .mod = 0x00, .key = HID_KEY_E },  // e
+      [0x66] = { .mod = 0x00, .key = HID_KEY_F },  // f
+      [0x67] = { .mod = 0x00, .key = HID_KEY_G },  // g
+      [0x68] = { .mod = 0x00, .key = HID_KEY_H },  // h
+      [0x69] = { .mod = 0x00, .key = HID_KEY_I },  // i
+      [0x6A] = { .mod = 0x00, .key = HID_KEY_J },  // j
+      [0x6B] = { .mod = 0x00, .key = HID_KEY_K },  // k
+      [0x6C] = { .mod = 0x00, .key = HID_KEY_L },  // l
+      [0x6D] = { .mod = 0x00, .key = HID_KEY_M },  // m
+      [0x6E] = { .mod = 0x00, .key = HID_KEY_N },  // n
+      [0x6F] = { .mod = 0x00, .key = HID_KEY_O },  // o
+      [0x70] = { .mod = 0x00, .key = HID_KEY_P },  // p
+      [0x71] = { .mod = 0x00, .key = HID_KEY_Q },  // q
+      [0x72] = { .mod = 0x00, .key = HID_KEY_R },  // r
+      [0x73] = { .mod = 0x00, .key = HID_KEY_S },  // s
+      [0x74] = { .mod = 0x00, .key = HID_KEY_T },  // t
+      [0x75] = { .mod = 0x00, .key = HID_KEY_U },  // u
+      [0x76] = { .mod = 0x00, .key = HID_KEY_V },  // v
+      [0x77] = { .mod = 0x00, .key = HID_KEY_W },  // w
+      [0x78] = { .mod = 0x00, .key = HID_KEY_X },  // x
+      [0x79] = { .mod = 0x00, .key = HID_KEY_Y },  // y
+      [0x7A] = { .mod = 0x00, .key = HID_KEY_Z },  // z
+      [0x7B] = { .mod = 0x02, .key = HID_KEY_LEFT_BRKT },  // {
+      [0x7C] = { .mod = 0x02, .key = HID_KEY_BACK_SLASH },  // |
+      [0x7D] = { .mod = 0x02, .key = HID_KEY_RIGHT_BRKT },  // }
+      [0x7E] = { .mod = 0x02, .key = HID_KEY_GRV_ACCENT },  // ~
+    },
+  },
+  {
+    .name = "de",
+    .ascii = {
+      [0x09] = { .mod = 0x00, .key = HID_KEY_TAB },
+      [0x0A] = { .mod = 0x00, .key = HID_KEY_RETURN },
+      [0x20] = { .mod = 0x00, .key = HID_KEY_SPACEBAR },
+      [0x21] = { .mod = 0x02, .key = HID_KEY_1 },  // !
+      [0x22] = { .mod = 0x02, .key = HID_KEY_2 },  // "
+      [0x23] = { .mod = 0x00, .key = HID_KEY_NONUS_HASH },  // #
+      [0x24] = { .mod = 0x02, .key = HID_KEY_4 },  // $
+      [0x25] = { .mod = 0x02, .key = HID_KEY_5 },  // %
+      [0x26] = { .mod = 0x02, .key = HID_KEY_6 },  // &
+      [0x27] = { .mod = 0x02, .key = HID_KEY_NONUS_HASH },  // '
+      [0x28] = { .mod = 0x02, .key = HID_KEY_8 },  // (
+      [0x29] = { .mod = 0x02, .key = HID_KEY_9 },  // )
+      [0x2A] = { .mod = 0x02, .key = HID_KEY_RIGHT_BRKT },  // *
+      [0x2B] = { .mod = 0x00, .key = HID_KEY_RIGHT_BRKT },  // +
+      [0x2C] = { .mod = 0x00, .key = HID_KEY_COMMA },  // ,
+      [0x2D] = { .mod = 0x00, .key = HID_KEY_FWD_SLASH },  // -
+      [0x2E] = { .mod = 0x00, .key = HID_KEY_DOT },  // .
+      [0x2F] = { .mod = 0x02, .key = HID_KEY_7 },  // /
+      [0x30] = { .mod = 0x00, .key = HID_KEY_0 },  // 0
+      [0x31] = { .mod = 0x00, .key = HID_KEY_1 },  // 1
+      [0x32] = { .mod = 0x00, .key = HID_KEY_2 },  // 2
+      [0x33] = { .mod = 0x00, .key = HID_KEY_3 },  // 3
+      [0x34] = { .mod = 0x00, .key = HID_KEY_4 },  // 4
+      [0x35] = { .mod = 0x00, .key = HID_KEY_5 },  // 5
+      [0x36] = { .mod = 0x00, .key = HID_KEY_6 },  // 6
+      [0x37] = { .mod = 0x00, .key = HID_KEY_7 },  // 7
+      [0x38] = { .mod = 0x00, .key = HID_KEY_8 },  // 8
+      [0x39] = { .mod = 0x00, .key = HID_KEY_9 },  // 9
+      [0x3A] = { .mod = 0x02, .key = HID_KEY_DOT },  // :
+      [0x3B] = { .mod = 0x02, .key = HID_KEY_COMMA },  // ;
+      [0x3C] = { .mod = 0x00, .key = HID_KEY_NONUS_BACK_SLASH },  // <
+      [0x3D] = { .mod = 0x02, .key = HID_KEY_0 },  // =
+      [0x3E] = { .mod = 0x02, .key = HID_KEY_NONUS_BACK_SLASH },  // >
+      [0x3F] = { .mod = 0x02, .key = HID_KEY_MINUS },  // ?
+      [0x40] = { .mod = 0x40, .key = HID_KEY_Q },  // @
+      [0x41] = { .mod = 0x02, .key = HID_KEY_A },  // A
+      [0x42] = { .mod = 0x02, .key = HID_KEY_B },  // B
+      [0x43] = { .mod = 0x02, .key = HID_KEY_C },  // C
+      [0x44] = { .mod = 0x02, .key = HID_KEY_D },  // D
+      [0x45] = { .mod = 0x02, .key = HID_KEY_E },  // E
+      [0x46] = { .mod = 0x02, .key = HID_KEY_F },  // F
+      [0x47] = { .mod = 0x02, .key = HID_KEY_G },  // G
+      [0x48] = { .mod = 0x02, .key = HID_KEY_H },  // H
+      [0x49] = { .mod = 0x02, .key = HID_KEY_I },  // I
+      [0x4A] = { .mod = 0x02, .key = HID_KEY_J },  // J
+      [0x4B] = { .mod = 0x02, .key = HID_KEY_K },  // K
+      [0x4C] = { .mod = 0x02, .key = HID_KEY_L },  // L
+      [0x4D] = { .mod = 0x02, .key = HID_KEY_M },  // M
+      [0x4E] = { .mod = 0x02, .key = HID_KEY_N },  // N
+      [0x4F] = { .mod = 0x02, .key = HID_KEY_O },  // O
+      [0x50] = { .mod = 0x02, .key = HID_KEY_P },  // P
+      [0x51] = { .mod = 0x02, .key = HID_KEY_Q },  // Q
+      [0x52] = { .mod = 0x02, .key = HID_KEY_R },  // R
+      [0x53] = { .mod = 0x02, .key = HID_KEY_S },  // S
+      [0x54] = { .mod = 0x02, .key = HID_KEY_T },  // T
+      [0x55] = { .mod = 0x02, .key = HID_KEY_U },  // U
+      [0x56] = { .mod = 0x02, .key = HID_KEY_V },  // V
+      [0x57] = { .mod = 0x02, .key = HID_KEY_W },  // W
+      [0x58] = { .mod = 0x02, .key = HID_KEY_X },  // X
+      [0x59] = { .mod = 0x02, .key = HID_KEY_Z },  // Y
+      [0x5A] = { .mod = 0x02, .key = HID_KEY_Y },  // Z
+      [0x5B] = { .mod = 0x40, .key = HID_KEY_8 },  // [
+      [0x5C] = { .mod = 0x40, .key = HID_KEY_MINUS },
+      [0x5D] = { .mod = 0x40, .key = HID_KEY_9 },  // ]
+      [0x5E] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x00, .dead_key = HID_KEY_GRV_ACCENT },  // ^
+      [0x5F] = { .mod = 0x02, .key = HID_KEY_FWD_SLASH },  // _
+      [0x60] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL },  // `
+      [0x61] = { .mod = 0x00, .key = HID_KEY_A },  // a
+      [0x62] = { .mod = 0x00, .key = HID_KEY_B },  // b
+      [0x63] = { .mod = 0x00, .key = HID_KEY_C },  // c
+      [0x64] = { .mod = 0x00, .key = HID_KEY_D },  // d
+      [0x65] = { .mod = 0x00, .key = HID_KEY_E },  // e
+      [0x66] = { .mod = 0x00, .key = HID_KEY_F },  // f
+      [0x67] = { .mod = 0x00, .key = HID_KEY_G },  // g
+      [0x68] = { .mod = 0x00, .key = HID_KEY_H },  // h
+      [0x69] = { .mod = 0x00, .key = HID_KEY_I },  // i
+      [0x6A] = { .mod = 0x00, .key = HID_KEY_J },  // j
+      [0x6B] = { .mod = 0x00, .key = HID_KEY_K },  // k
+      [0x6C] = { .mod = 0x00, .key = HID_KEY_L },  // l
+      [0x6D] = { .mod = 0x00, .key = HID_KEY_M },  // m
+      [0x6E] = { .mod = 0x00, .key = HID_KEY_N },  // n
+      [0x6F] = { .mod = 0x00, .key = HID_KEY_O },  // o
+      [0x70] = { .mod = 0x00, .key = HID_KEY_P },  // p
+      [0x71] = { .mod = 0x00, .key = HID_KEY_Q },  // q
+      [0x72] = { .mod = 0x00, .key = HID_KEY_R },  // r
+      [0x73] = { .mod = 0x00, .key = HID_KEY_S },  // s
+      [0x74] = { .mod = 0x00, .key = HID_KEY_T },  // t
+      [0x75] = { .mod = 0x00, .key = HID_KEY_U },  // u
+      [0x76] = { .mod = 0x00, .key = HID_KEY_V },  // v
+      [0x77] = { .mod = 0x00, .key = HID_KEY_W },  // w
+      [0x78] = { .mod = 0x00, .key = HID_KEY_X },  // x
+      [0x79] = { .mod = 0x00, .key = HID_KEY_Z },  // y
+      [0x7A] = { .mod = 0x00, .key = HID_KEY_Y },  // z
+      [0x7B] = { .mod = 0x40, .key = HID_KEY_7 },  // {
+      [0x7C] = { .mod = 0x40, .key = HID_KEY_NONUS_BACK_SLASH },  // |
+      [0x7D] = { .mod = 0x40, .key = HID_KEY_0 },  // }
+      [0x7E] = { .mod = 0x40, .key = HID_KEY_RIGHT_BRKT },  // ~
+    },
+    .extras_len = sizeof(de_extras) / sizeof(de_extras[0]),
+    .extras = de_extras,
+  },
+  {
+    .name = "dk",
+    .ascii = {
+      [0x09] = { .mod = 0x00, .key = HID_KEY_TAB },
+      [0x0A] = { .mod = 0x00, .key = HID_KEY_RETURN },
+      [0x20] = { .mod = 0x00, .key = HID_KEY_SPACEBAR },
+      [0x21] = { .mod = 0x02, .key = HID_KEY_1 },  // !
+      [0x22] = { .mod = 0x02, .key = HID_KEY_2 },  // "
+      [0x23] = { .mod = 0x02, .key = HID_KEY_3 },  // #
+      [0x24] = { .mod = 0x40, .key = HID_KEY_4 },  // $
+      [0x25] = { .mod = 0x02, .key = HID_KEY_5 },  // %
+      [0x26] = { .mod = 0x02, .key = HID_KEY_6 },  // &
+      [0x27] = { .mod = 0x00, .key = HID_KEY_NONUS_HASH },  // '
+      [0x28] = { .mod = 0x02, .key = HID_KEY_8 },  // (
+      [0x29] = { .mod = 0x02, .key = HID_KEY_9 },  // )
+      [0x2A] = { .mod = 0x02, .key = HID_KEY_NONUS_HASH },  // *
+      [0x2B] = { .mod = 0x00, .key = HID_KEY_MINUS },  // +
+      [0x2C] = { .mod = 0x00, .key = HID_KEY_COMMA },  // ,
+      [0x2D] = { .mod = 0x00, .key = HID_KEY_FWD_SLASH },  // -
+      [0x2E] = { .mod = 0x00, .key = HID_KEY_DOT },  // .
+      [0x2F] = { .mod = 0x02, .key = HID_KEY_7 },  // /
+      [0x30] = { .mod = 0x00, .key = HID_KEY_0 },  // 0
+      [0x31] = { .mod = 0x00, .key = HID_KEY_1 },  // 1
+      [0x32] = { .mod = 0x00, .key = HID_KEY_2 },  // 2
+      [0x33] = { .mod = 0x00, .key = HID_KEY_3 },  // 3
+      [0x34] = { .mod = 0x00, .key = HID_KEY_4 },  // 4
+      [0x35] = { .mod = 0x00, .key = HID_KEY_5 },  // 5
+      [0x36] = { .mod = 0x00, .key = HID_KEY_6 },  // 6
+      [0x37] = { .mod = 0x00, .key = HID_KEY_7 },  // 7
+      [0x38] = { .mod = 0x00, .key = HID_KEY_8 },  // 8
+      [0x39] = { .mod = 0x00, .key = HID_KEY_9 },  // 9
+      [0x3A] = { .mod = 0x02, .key = HID_KEY_DOT },  // :
+      [0x3B] = { .mod = 0x02, .key = HID_KEY_COMMA },  // ;
+      [0x3C] = { .mod = 0x00, .key = HID_KEY_NONUS_BACK_SLASH },  // <
+      [0x3D] = { .mod = 0x02, .key = HID_KEY_0 },  // =
+      [0x3E] = { .mod = 0x02, .key = HID_KEY_NONUS_BACK_SLASH },  // >
+      [0x3F] = { .mod = 0x02, .key = HID_KEY_MINUS },  // ?
+      [0x40] = { .mod = 0x40, .key = HID_KEY_2 },  // @
+      [0x41] = { .mod = 0x02, .key = HID_KEY_A },  // A
+      [0x42] = { .mod = 0x02, .key = HID_KEY_B },  // B
+      [0x43] = { .mod = 0x02, .key = HID_KEY_C },  // C
+      [0x44] = { .mod = 0x02, .key = HID_KEY_D },  // D
+      [0x45] = { .mod = 0x02, .key = HID_KEY_E },  // E
+      [0x46] = { .mod = 0x02, .key = HID_KEY_F },  // F
+      [0x47] = { .mod = 0x02, .key = HID_KEY_G },  // G
+      [0x48] = { .mod = 0x02, .key = HID_KEY_H },  // H
+      [0x49] = { .mod = 0x02, .key = HID_KEY_I },  // I
+      [0x4A] = { .mod = 0x02, .key = HID_KEY_J },  // J
+      [0x4B] = { .mod = 0x02, .key = HID_KEY_K },  // K
+      [0x4C] = { .mod = 0x02, .key = HID_KEY_L },  // L
+      [0x4D] = { .mod = 0x02, .key = HID_KEY_M },  // M
+      [0x4E] = { .mod = 0x02, .key = HID_KEY_N },  // N
+      [0x4F] = { .mod = 0x02, .key = HID_KEY_O },  // O
+      [0x50] = { .mod = 0x02, .key = HID_KEY_P },  // P
+      [0x51] = { .mod = 0x02, .key = HID_KEY_Q },  // Q
+      [0x52] = { .mod = 0x02, .key = HID_KEY_R },  // R
+      [0x53] = { .mod = 0x02, .key = HID_KEY_S },  // S
+      [0x54] = { .mod = 0x02, .key = HID_KEY_T },  // T
+      [0x55] = { .mod = 0x02, .key = HID_KEY_U },  // U
+      [0x56] = { .mod = 0x02, .key = HID_KEY_V },  // V
+      [0x57] = { .mod = 0x02, .key = HID_KEY_W },  // W
+      [0x58] = { .mod = 0x02, .key = HID_KEY_X },  // X
+      [0x59] = { .mod = 0x02, .key = HID_KEY_Y },  // Y
+      [0x5A] = { .mod = 0x02, .key = HID_KEY_Z },  // Z
+      [0x5B] = { .mod = 0x40, .key = HID_KEY_8 },  // [
+      [0x5C] = { .mod = 0x40, .key = HID_KEY_NONUS_BACK_SLASH },
+      [0x5D] = { .mod = 0x40, .key = HID_KEY_9 },  // ]
+      [0x5E] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x02, .dead_key = HID_KEY_RIGHT_BRKT },  // ^
+      [0x5F] = { .mod = 0x02, .key = HID_KEY_FWD_SLASH },  // _
+      [0x60] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x02, .dead_key = HID_KEY_EQUAL },  // `
+      [0x61] = { .mod = 0x00, .key = HID_KEY_A },  // a
+      [0x62] = { .mod = 0x00, .key = HID_KEY_B },  // b
+      [0x63] = { .mod = 0x00, .key = HID_KEY_C },  // c
+      [0x64] = { .mod = 0x00, .key = HID_KEY_D },  // d
+      [0x65] = { .mod = 0x00, .key = HID_KEY_E },  // e
+      [0x66] = { .mod = 0x00, .key = HID_KEY_F },  // f
+      [0x67] = { .mod = 0x00, .key = HID_KEY_G },  // g
+      [0x68] = { .mod = 0x00, .key = HID_KEY_H },  // h
+      [0x69] = { .mod = 0x00, .key = HID_KEY_I },  // i
+      [0x6A] = { .mod = 0x00, .key = HID_KEY_J },  // j
+      [0x6B] = { .mod = 0x00, .key = HID_KEY_K },  // k
+      [0x6C] = { .mod = 0x00, .key = HID_KEY_L },  // l
+      [0x6D] = { .mod = 0x00, .key = HID_KEY_M },  // m
+      [0x6E] = { .mod = 0x00, .key = HID_KEY_N },  // n
+      [0x6F] = { .mod = 0x00, .key = HID_KEY_O },  // o
+      [0x70] = { .mod = 0x00, .key = HID_KEY_P },  // p
+      [0x71] = { .mod = 0x00, .key = HID_KEY_Q },  // q
+      [0x72] = { .mod = 0x00, .key = HID_KEY_R },  // r
+      [0x73] = { .mod = 0x00, .key = HID_KEY_S },  // s
+      [0x74] = { .mod = 0x00, .key = HID_KEY_T },  // t
+      [0x75] = { .mod = 0x00, .key = HID_KEY_U },  // u
+      [0x76] = { .mod = 0x00, .key = HID_KEY_V },  // v
+      [0x77] = { .mod = 0x00, .key = HID_KEY_W },  // w
+      [0x78] = { .mod = 0x00, .key = HID_KEY_X },  // x
+      [0x79] = { .mod = 0x00, .key = HID_KEY_Y },  // y
+      [0x7A] = { .mod = 0x00, .key = HID_KEY_Z },  // z
+      [0x7B] = { .mod = 0x40, .key = HID_KEY_7 },  // {
+      [0x7C] = { .mod = 0x40, .key = HID_KEY_EQUAL },  // |
+      [0x7D] = { .mod = 0x40, .key = HID_KEY_0 },  // }
+      [0x7E] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x40, .dead_key = HID_KEY_RIGHT_BRKT },  // ~
+    },
+    .extras_len = sizeof(dk_extras) / sizeof(dk_extras[0]),
+    .extras = dk_extras,
+  },
+  {
+    .name = "fr",
+    .ascii = {
+      [0x09] = { .mod = 0x00, .key = HID_KEY_TAB },
+      [0x0A] = { .mod = 0x00, .key = HID_KEY_RETURN },
+      [0x20] = { .mod = 0x00, .key = HID_KEY_SPACEBAR },
+      [0x21] = { .mod = 0x00, .key = HID_KEY_FWD_SLASH },  // !
+      [0x22] = { .mod = 0x00, .key = HID_KEY_3 },  // "
+      [0x23] = { .mod = 0x40, .key = HID_KEY_3 },  // #
+      [0x24] = { .mod = 0x00, .key = HID_KEY_RIGHT_BRKT },  // $
+      [0x25] = { .mod = 0x02, .key = HID_KEY_SGL_QUOTE },  // %
+      [0x26] = { .mod = 0x00, .key = HID_KEY_1 },  // &
+      [0x27] = { .mod = 0x00, .key = HID_KEY_4 },  // '
+      [0x28] = { .mod = 0x00, .key = HID_KEY_5 },  // (
+      [0x29] = { .mod = 0x00, .key = HID_KEY_MINUS },  // )
+      [0x2A] = { .mod = 0x00, .key = HID_KEY_NONUS_HASH },  // *
+      [0x2B] = { .mod = 0x02, .key = HID_KEY_EQUAL },  // +
+      [0x2C] = { .mod = 0x00, .key = HID_KEY_M },  // ,
+      [0x2D] = { .mod = 0x00, .key = HID_KEY_6 },  // -
+      [0x2E] = { .mod = 0x02, .key = HID_KEY_COMMA },  // .
+      [0x2F] = { .mod = 0x02, .key = HID_KEY_DOT },  // /
+      [0x30] = { .mod = 0x02, .key = HID_KEY_0 },  // 0
+      [0x31] = { .mod = 0x02, .key = HID_KEY_1 },  // 1
+      [0x32] = { .mod = 0x02, .key = HID_KEY_2 },  // 2
+      [0x33] = { .mod = 0x02, .key = HID_KEY_3 },  // 3
+      [0x34] = { .mod = 0x02, .key = HID_KEY_4 },  // 4
+      [0x35] = { .mod = 0x02, .key = HID_KEY_5 },  // 5
+      [0x36] = { .mod = 0x02, .key = HID_KEY_6 },  // 6
+      [0x37] = { .mod = 0x02, .key = HID_KEY_7 },  // 7
+      [0x38] = { .mod = 0x02, .key = HID_KEY_8 },  // 8
+      [0x39] = { .mod = 0x02, .key = HID_KEY_9 },  // 9
+      [0x3A] = { .mod = 0x00, .key = HID_KEY_DOT },  // :
+      [0x3B] = { .mod = 0x00, .key = HID_KEY_COMMA },  // ;
+      [0x3C] = { .mod = 0x00, .key = HID_KEY_NONUS_BACK_SLASH },  // <
+      [0x3D] = { .mod = 0x00, .key = HID_KEY_EQUAL },  // =
+      [0x3E] = { .mod = 0x02, .key = HID_KEY_NONUS_BACK_SLASH },  // >
+      [0x3F] = { .mod = 0x02, .key = HID_KEY_M },  // ?
+      [0x40] = { .mod = 0x40, .key = HID_KEY_0 },  // @
+      [0x41] = { .mod = 0x02, .key = HID_KEY_Q },  // A
+      [0x42] = { .mod = 0x02, .key = HID_KEY_B },  // B
+      [0x43] = { .mod = 0x02, .key = HID_KEY_C },  // C
+      [0x44] = { .mod = 0x02, .key = HID_KEY_D },  // D
+      [0x45] = { .mod = 0x02, .key = HID_KEY_E },  // E
+      [0x46] = { .mod = 0x02, .key = HID_KEY_F },  // F
+      [0x47] = { .mod = 0x02, .key = HID_KEY_G },  // G
+      [0x48] = { .mod = 0x02, .key = HID_KEY_H },  // H
+      [0x49] = { .mod = 0x02, .key = HID_KEY_I },  // I
+      [0x4A] = { .mod = 0x02, .key = HID_KEY_J },  // J
+      [0x4B] = { .mod = 0x02, .key = HID_KEY_K },  // K
+      [0x4C] = { .mod = 0x02, .key = HID_KEY_L },  // L
+      [0x4D] = { .mod = 0x02, .key = HID_KEY_SEMI_COLON },  // M
+      [0x4E] = { .mod = 0x02, .key = HID_KEY_N },  // N
+      [0x4F] = { .mod = 0x02, .key = HID_KEY_O },  // O
+      [0x50] = { .mod = 0x02, .key = HID_KEY_P },  // P
+      [0x51] = { .mod = 0x02, .key = HID_KEY_A },  // Q
+      [0x52] = { .mod = 0x02, .key = HID_KEY_R },  // R
+      [0x53] = { .mod = 0x02, .key = HID_KEY_S },  // S
+      [0x54] = { .mod = 0x02, .key = HID_KEY_T },  // T
+      [0x55] = { .mod = 0x02, .key = HID_KEY_U },  // U
+      [0x56] = { .mod = 0x02, .key = HID_KEY_V },  // V
+      [0x57] = { .mod = 0x02, .key = HID_KEY_Z },  // W
+      [0x58] = { .mod = 0x02, .key = HID_KEY_X },  // X
+      [0x59] = { .mod = 0x02, .key = HID_KEY_Y },  // Y
+      [0x5A] = { .mod = 0x02, .key = HID_KEY_W },  // Z
+      [0x5B] = { .mod = 0x40, .key = HID_KEY_5 },  // [
+      [0x5C] = { .mod = 0x40, .key = HID_KEY_8 },
+      [0x5D] = { .mod = 0x40, .key = HID_KEY_MINUS },  // ]
+      [0x5E] = { .mod = 0x40, .key = HID_KEY_9 },  // ^
+      [0x5F] = { .mod = 0x00, .key = HID_KEY_8 },  // _
+      [0x60] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x40, .dead_key = HID_KEY_7 },  // `
+      [0x61] = { .mod = 0x00, .key = HID_KEY_Q },  // a
+      [0x62] = { .mod = 0x00, .key = HID_KEY_B },  // b
+      [0x63] = { .mod = 0x00, .key = HID_KEY_C },  // c
+      [0x64] = { .mod = 0x00, .key = HID_KEY_D },  // d
+      [0x65] = { .mod = 0x00, .key = HID_KEY_E },  // e
+      [0x66] = { .mod = 0x00, .key = HID_KEY_F },  // f
+      [0x67] = { .mod = 0x00, .key = HID_KEY_G },  // g
+      [0x68] = { .mod = 0x00, .key = HID_KEY_H },  // h
+      [0x69] = { .mod = 0x00, .key = HID_KEY_I },  // i
+      [0x6A] = { .mod = 0x00, .key = HID_KEY_J },  // j
+      [0x6B] = { .mod = 0x00, .key = HID_KEY_K },  // k
+      [0x6C] = { .mod = 0x00, .key = HID_KEY_L },  // l
+      [0x6D] = { .mod = 0x00, .key = HID_KEY_SEMI_COLON },  // m
+      [0x6E] = { .mod = 0x00, .key = HID_KEY_N },  // n
+      [0x6F] = { .mod = 0x00, .key = HID_KEY_O },  // o
+      [0x70] = { .mod = 0x00, .key = HID_KEY_P },  // p
+      [0x71] = { .mod = 0x00, .key = HID_KEY_A },  // q
+      [0x72] = { .mod = 0x00, .key = HID_KEY_R },  // r
+      [0x73] = { .mod = 0x00, .key = HID_KEY_S },  // s
+      [0x74] = { .mod = 0x00, .key = HID_KEY_T },  // t
+      [0x75] = { .mod = 0x00, .key = HID_KEY_U },  // u
+      [0x76] = { .mod = 0x00, .key = HID_KEY_V },  // v
+      [0x77] = { .mod = 0x00, .key = HID_KEY_Z },  // w
+      [0x78] = { .mod = 0x00, .key = HID_KEY_X },  // x
+      [0x79] = { .mod = 0x00, .key = HID_KEY_Y },  // y
+      [0x7A] = { .mod = 0x00, .key = HID_KEY_W },  // z
+      [0x7B] = { .mod = 0x40, .key = HID_KEY_4 },  // {
+      [0x7C] = { .mod = 0x40, .key = HID_KEY_6 },  // |
+      [0x7D] = { .mod = 0x40, .key = HID_KEY_EQUAL },  // }
+      [0x7E] = { .mod = 0x00, .key = HID_KEY_SPACEBAR, .dead_mod = 0x40, .dead_key = HID_KEY_2 },  // ~
+    },
+    .extras_len = sizeof(fr_extras) / sizeof(fr_extras[0]),
+    .extras = fr_extras,
+  },
+};
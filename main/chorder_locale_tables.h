@@ -0,0 +1,14 @@
+// Generated by host/locale_gen from us.layout, de.layout, dk.layout, fr.layout; edit those instead.
+#ifndef _CHORDER_LOCALE_TABLES_H_
+#define _CHORDER_LOCALE_TABLES_H_
+
+// As stored in the "locale" NVS setting:
+enum locale {
+  LOCALE_US,
+  LOCALE_DE,
+  LOCALE_DK,
+  LOCALE_FR,
+  LOCALES
+};
+
+#endif
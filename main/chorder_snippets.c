@@ -0,0 +1,159 @@
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#include "chorder_handlers.h"
+#include "chorder_snippets.h"
+#include "chorder_locale.h"
+#include "chorder_unicode.h"
+#include "chorder_keyreport.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Snippet texts
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+const char *const snippet_texts[SNIPPETS] = {
+  [0] = "Kind regards,\n",
+  [1] = "#include <stdio.h>\n\nint main(int argc, char **argv)\n{\n\treturn 0;\n}\n",
+};
+
+// }}}
+
+////////////////////////////////////////////////////////////////////////////////
+// Streaming
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+snippet_stats_t snippet_stats;
+
+// Single-producer, single-consumer, as chorder_keyring.h's ring is:
+static uint8_t queue[SNIPPET_QUEUE_SIZE];
+static uint32_t queue_head = 0;            // written by the decoder only
+static uint32_t queue_tail = 0;            // written by the snippet task only
+// Snippets queued before this are cut short; written by the decoder only:
+static uint32_t cancel_head = 0;
+static TaskHandle_t snippet_streamer = NULL;
+
+bool snippet_send(uint8_t snippet)
+{
+  if (snippet >= SNIPPETS || NULL == snippet_texts[snippet])
+    return false;
+  uint32_t head = queue_head;
+  uint32_t tail = __atomic_load_n(&queue_tail, __ATOMIC_ACQUIRE);
+  if (head - tail >= SNIPPET_QUEUE_SIZE) {
+    snippet_stats.dropped++;
+    return false;
+  }
+  queue[head & (SNIPPET_QUEUE_SIZE - 1)] = snippet;
+  // Publish the snippet only once it's been written:
+  __atomic_store_n(&queue_head, head + 1, __ATOMIC_RELEASE);
+  if (NULL != snippet_streamer)
+    xTaskNotifyGive(snippet_streamer);
+  return true;
+}
+
+bool snippet_pending(void)
+{
+  return __atomic_load_n(&queue_head, __ATOMIC_ACQUIRE) != __atomic_load_n(&queue_tail, __ATOMIC_ACQUIRE);
+}
+
+void snippet_cancel(void)
+{
+  __atomic_store_n(&cancel_head, queue_head, __ATOMIC_RELEASE);
+}
+
+// Whether the snippet at the head of the queue was cancelled:
+static bool cancelled(void)
+{
+  return (int32_t) (__atomic_load_n(&cancel_head, __ATOMIC_ACQUIRE) - queue_tail) > 0;
+}
+
+// Reports are sent through sendKeys(), which blocks while the HID transmit
+// queue is full, and so paces the stream to what the link takes:
+bool snippet_stream(const char *text)
+{
+  keyreport_t kr;
+  keyreport_init(&kr, sendKeys);
+  const char *end = text + strlen(text);
+  for (const char *c = text; c < end; ) {
+    if (!sec_conn) {
+      snippet_stats.aborted++;
+      snippet_stats.reports += kr.reports;
+      return false;
+    }
+    if (cancelled()) {
+      // Leaving no key down:
+      keyreport_flush(&kr);
+      snippet_stats.cancelled++;
+      snippet_stats.reports += kr.reports;
+      return false;
+    }
+    uint32_t codepoint = locale_utf8_next(&c, end - c);
+    const locale_stroke_t *stroke = locale_lookup(codepoint);
+    if (NULL == stroke) {
+      // Through the host's input method, which leaves every key up:
+      unicode_report_t reports[UNICODE_MAX_REPORTS];
+      size_t count = unicode_reports(codepoint, reports);
+      if (0 == count) {
+        snippet_stats.unmapped++;
+        continue;
+      }
+      keyreport_flush(&kr);
+      for (size_t i = 0; i < count; i++)
+        sendKeys(reports[i].mod, &reports[i].key, 1);
+      snippet_stats.reports += count;
+      snippet_stats.chars++;
+      continue;
+    }
+    if (0 != stroke->dead_key)
+      keyreport_tap(&kr, stroke->dead_mod, stroke->dead_key);
+    keyreport_tap(&kr, stroke->mod, stroke->key);
+    snippet_stats.chars++;
+  }
+  keyreport_flush(&kr);
+  snippet_stats.reports += kr.reports;
+  snippet_stats.snippets++;
+  return true;
+}
+
+bool snippet_type_next(void)
+{
+  uint32_t tail = queue_tail;
+  uint32_t head = __atomic_load_n(&queue_head, __ATOMIC_ACQUIRE);
+  if (head == tail)
+    return false;
+  snippet_stream(snippet_texts[queue[tail & (SNIPPET_QUEUE_SIZE - 1)]]);
+  // Only taken off the queue once it's been typed (or cancelled), so that it
+  // stays pending meanwhile:
+  __atomic_store_n(&queue_tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+void snippet_task(void *pvParameters)
+{
+  TaskHandle_t decoder = (TaskHandle_t) pvParameters;
+  snippet_streamer = xTaskGetCurrentTaskHandle();
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (snippet_type_next())
+      ;
+    // For it to get on with a chord that cancelled them:
+    if (NULL != decoder)
+      xTaskNotifyGive(decoder);
+  }
+}
+
+void snippet_dump(void)
+{
+  ESP_LOGI(__FUNCTION__, "snippets: %u typed, %u chars in %u reports, %u unmapped chars, %u dropped, %u aborted, %u cancelled",
+      (unsigned) snippet_stats.snippets, (unsigned) snippet_stats.chars, (unsigned) snippet_stats.reports,
+      (unsigned) snippet_stats.unmapped,
+      (unsigned) snippet_stats.dropped, (unsigned) snippet_stats.aborted,
+      (unsigned) snippet_stats.cancelled);
+}
+
+// }}}
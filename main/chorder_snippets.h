@@ -0,0 +1,61 @@
+#ifndef _CHORDER_SNIPPETS_H_
+#define _CHORDER_SNIPPETS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Snippets are texts kept in flash, bound to chords through the SNIPPET_*
+ * symbols, and typed out by a background task so that a long one doesn't
+ * hold up the decoder (or the scanner behind it). Texts may be several KB,
+ * in UTF-8, and are typed in the host's layout (see chorder_locale.h), or
+ * failing that through its Unicode input method (see chorder_unicode.h).
+ *
+ * Nothing else is typed while a snippet is pending. The decoder goes on
+ * taking key events meanwhile, but a chord committed over a snippet cancels
+ * it (and any queued behind it), and is only typed once the snippet task has
+ * let go; so a long snippet can be stopped by typing on.
+ */
+#define SNIPPETS 8
+// Snippets waiting to be typed out; must be a power of two:
+#define SNIPPET_QUEUE_SIZE 8
+
+extern const char *const snippet_texts[SNIPPETS];
+
+typedef struct {
+  uint32_t snippets;                       // snippets typed out in full
+  uint32_t chars;                          // characters sent
+  uint32_t reports;                        // keyboard reports they took
+  uint32_t unmapped;                       // characters without a key, skipped
+  uint32_t dropped;                        // snippets not queued on a full queue
+  uint32_t aborted;                        // snippets cut short by a disconnect
+  uint32_t cancelled;                      // snippets cut short by snippet_cancel()
+} snippet_stats_t;
+
+extern snippet_stats_t snippet_stats;
+
+/* Queues snippet for typing out. Called from the decoder, so this never
+ * blocks; returns false (counting the drop) on a full queue.
+ */
+bool snippet_send(uint8_t snippet);
+// Whether a snippet is queued, or still being typed out:
+bool snippet_pending(void);
+/* Cuts short the snippet being typed out, and drops those queued so far.
+ * Called from the decoder; the snippet task lets go at its next report.
+ */
+void snippet_cancel(void);
+
+/* Types text out, packing up to six keys to a report (see chorder_keyreport.h),
+ * as fast as the HID transmit queue takes them. Stops early, returning false,
+ * if the connection goes away or the snippet is cancelled meanwhile.
+ */
+bool snippet_stream(const char *text);
+
+// Types out the next queued snippet, if any; only for the snippet task:
+bool snippet_type_next(void);
+// Types out queued snippets as they come, notifying the task passed as
+// pvParameters (the decoder) once they're all out:
+void snippet_task(void *pvParameters);
+void snippet_dump(void);
+
+#endif
@@ -0,0 +1,62 @@
+#include "esp_log.h"
+
+#include "chorder_taphold.h"
+
+#define HOLD_MOD(mask) { .role = HOLD_MODIFIER, .arg = (mask) }
+#define HOLD_LAYER(layer) { .role = HOLD_LAYER, .arg = (layer) }
+
+// Indexed by chord, i.e. FCN IMRP bits. Chords typed while one is held can
+// only use the keys it leaves free, so thumb chords make the best holds:
+const hold_binding_t hold_bindings[KEYMAP_CHORDS] = {
+  [0x40] = HOLD_MOD(0x02),                 // F: tap for one-shot shift, hold for shift
+  [0x60] = HOLD_MOD(0x01),                 // FC: tap for one-shot right shift, hold for left control
+  [0x10] = HOLD_LAYER(KEYMAP_NUMSYM),      // N: tap for one-shot numsym, hold for numsym
+};
+
+void taphold_init(taphold_t *th, int32_t hold_us)
+{
+  th->hold_us = hold_us;
+  th->candidate = 0;
+  th->candidate_since = 0;
+  th->held_chord = 0;
+  th->held_keys = 0;
+}
+
+uint8_t taphold_feed(taphold_t *th, uint8_t keyState, int64_t now, uint8_t *released)
+{
+  *released = 0;
+  // A held chord lets go as soon as any of its keys does, but the rest of its
+  // keys are kept out of chords until they're up, too:
+  if (0 != th->held_chord && (keyState & th->held_chord) != th->held_chord) {
+    *released = th->held_chord;
+    th->held_chord = 0;
+  }
+  th->held_keys &= keyState;
+
+  // Dual-role chords are up for holding for as long as they're held still:
+  if (0 == th->held_keys && taphold_is_dual_role(keyState)) {
+    th->candidate = keyState;
+    th->candidate_since = now;
+  } else {
+    th->candidate = 0;
+  }
+  return keyState & ~th->held_keys;
+}
+
+int64_t taphold_deadline(const taphold_t *th)
+{
+  if (0 == th->candidate)
+    return -1;
+  return th->candidate_since + th->hold_us;
+}
+
+uint8_t taphold_resolve(taphold_t *th, int64_t now)
+{
+  if (0 == th->candidate || now < th->candidate_since + th->hold_us)
+    return 0;
+  ESP_LOGD(__FUNCTION__, "Chord 0x%02x held", th->candidate);
+  th->held_chord = th->candidate;
+  th->held_keys = th->candidate;
+  th->candidate = 0;
+  return th->held_chord;
+}
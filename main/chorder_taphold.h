@@ -0,0 +1,60 @@
+#ifndef _CHORDER_TAPHOLD_H_
+#define _CHORDER_TAPHOLD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "chorder_keymap.h"
+
+/* Tap-hold (dual-role) chords: tapped, a chord types its symbol as usual;
+ * held still for the hold time, it instead holds down a modifier or a layer
+ * for as long as its keys are down, while other chords are typed with the
+ * remaining keys.
+ */
+typedef enum {
+  HOLD_NONE,
+  HOLD_MODIFIER,                           // arg is the modifier mask to hold
+  HOLD_LAYER,                              // arg is the keymap layer to hold
+} hold_role_t;
+
+typedef struct {
+  uint8_t role;                            // hold_role_t
+  uint8_t arg;
+} hold_binding_t;
+
+extern const hold_binding_t hold_bindings[KEYMAP_CHORDS];
+
+/* Resolves tap-hold chords, sitting between the debouncer and the chord
+ * machine. Whether a chord is held is decided by a deadline, rather than on
+ * release: the decoder wakes up for taphold_deadline() and calls
+ * taphold_resolve(). Once a chord is held, its keys are left out of the
+ * keyStates passed on until they're all up.
+ */
+typedef struct {
+  int32_t hold_us;
+  uint8_t candidate;                       // dual-role chord held still, or 0
+  int64_t candidate_since;
+  uint8_t held_chord;                      // chord resolved as held, or 0
+  uint8_t held_keys;                       // its keys still down
+} taphold_t;
+
+void taphold_init(taphold_t *th, int32_t hold_us);
+
+static inline bool taphold_is_dual_role(uint8_t chord)
+{
+  return HOLD_NONE != hold_bindings[chord].role;
+}
+
+/* Feeds the next debounced keyState, changed at now, and returns the keyState
+ * to pass on to the chord machine. Sets *released to a held chord that's
+ * just had a key come up, and so no longer holds anything; 0 otherwise.
+ */
+uint8_t taphold_feed(taphold_t *th, uint8_t keyState, int64_t now, uint8_t *released);
+
+// When the chord held still will count as held, or -1 if there's none:
+int64_t taphold_deadline(const taphold_t *th);
+
+// The chord that's now held, if its deadline has passed by now; 0 otherwise:
+uint8_t taphold_resolve(taphold_t *th, int64_t now);
+
+#endif
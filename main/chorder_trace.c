@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#include "chorder_trace.h"
+
+int trace_format_line(char *buf, size_t len, const key_event_t *sample)
+{
+  return snprintf(buf, len, TRACE_LINE_PREFIX "%lld %02x\n", (long long) sample->timestamp, sample->keyState);
+}
+
+bool trace_parse_line(const char *line, key_event_t *sample)
+{
+  const char *p = strstr(line, TRACE_LINE_PREFIX);
+  if (NULL == p)
+    return false;
+  p += strlen(TRACE_LINE_PREFIX);
+
+  char *end;
+  long long timestamp = strtoll(p, &end, 10);
+  if (end == p)
+    return false;
+  p = end;
+  unsigned long keyState = strtoul(p, &end, 16);
+  if (end == p || keyState > 0x7F)
+    return false;
+
+  sample->timestamp = timestamp;
+  sample->keyState = (uint8_t) keyState;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Recording
+////////////////////////////////////////////////////////////////////////////////
+// {{{
+
+static key_event_ring_t trace_samples;
+static TaskHandle_t trace_writer = NULL;
+
+void trace_record(int64_t timestamp, uint8_t raw)
+{
+  key_event_t sample = {
+    .timestamp = timestamp,
+    .keyState = raw,
+  };
+  key_event_ring_push(&trace_samples, &sample);
+  if (NULL != trace_writer)
+    xTaskNotifyGive(trace_writer);
+}
+
+void trace_writer_task(void *pvParameters)
+{
+  uint32_t reported_overflows = 0;
+  char line[TRACE_LINE_MAX];
+
+#if CONFIG_CHORDER_TRACE_SPIFFS
+  FILE *out = fopen(CONFIG_CHORDER_TRACE_PATH, "a");
+  if (NULL == out) {
+    ESP_LOGE(__FUNCTION__, "Cannot open %s for appending; not recording", CONFIG_CHORDER_TRACE_PATH);
+    vTaskDelete(NULL);
+    return;
+  }
+  ESP_LOGI(__FUNCTION__, "Recording raw keystates to %s", CONFIG_CHORDER_TRACE_PATH);
+#else
+  FILE *out = stdout;
+  ESP_LOGI(__FUNCTION__, "Recording raw keystates to the console");
+#endif
+  trace_writer = xTaskGetCurrentTaskHandle();
+
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    if (reported_overflows != key_event_ring_overflows(&trace_samples)) {
+      reported_overflows = key_event_ring_overflows(&trace_samples);
+      ESP_LOGW(__FUNCTION__, "Trace ring overflowed; %u samples dropped in total", (unsigned) reported_overflows);
+    }
+
+    key_event_t sample;
+    while (key_event_ring_pop(&trace_samples, &sample)) {
+      trace_format_line(line, sizeof(line), &sample);
+      fputs(line, out);
+    }
+    // One flush per batch keeps SPIFFS writes (and UART line breaks) sane:
+    fflush(out);
+  }
+}
+
+// }}}
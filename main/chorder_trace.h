@@ -0,0 +1,37 @@
+#ifndef _CHORDER_TRACE_H_
+#define _CHORDER_TRACE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chorder_keyring.h"
+
+/* Recording of raw (pre-debounce) keyStates, for replaying real typing
+ * sessions through the debouncer and chord machine off-device.
+ *
+ * A trace is plain text, one sample per line:
+ *
+ *   KT <timestamp in us> <raw keyState in hex>
+ *
+ * The prefix lets trace lines be picked out of a console log they've been
+ * interleaved with.
+ */
+#define TRACE_LINE_PREFIX "KT "
+#define TRACE_LINE_MAX    40
+
+// Formats a sample as a trace line, newline included; returns its length:
+int trace_format_line(char *buf, size_t len, const key_event_t *sample);
+
+// Finds and parses a trace line; false for anything else:
+bool trace_parse_line(const char *line, key_event_t *sample);
+
+/* Queues a raw sample for the writer task. Called from the scanner, so this
+ * never blocks; samples are dropped (and counted) if the writer falls behind.
+ */
+void trace_record(int64_t timestamp, uint8_t raw);
+
+// Drains recorded samples to the console UART or a SPIFFS file, as configured:
+void trace_writer_task(void *pvParameters);
+
+#endif
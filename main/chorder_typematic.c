@@ -0,0 +1,40 @@
+#include "chorder_typematic.h"
+
+void typematic_init(typematic_t *tm, int32_t delay_us, int32_t interval_us)
+{
+  tm->delay_us = delay_us;
+  tm->interval_us = interval_us;
+  tm->chord = 0;
+  tm->held_since = 0;
+  tm->typed = 0;
+  tm->stopped = false;
+}
+
+uint8_t typematic_hold(typematic_t *tm, uint8_t chord, int64_t since)
+{
+  if (chord == tm->chord && since == tm->held_since)
+    return 0;
+  uint8_t typed_chord = 0 != tm->typed ? tm->chord : 0;
+  tm->chord = chord;
+  tm->held_since = since;
+  tm->typed = 0;
+  tm->stopped = false;
+  return typed_chord;
+}
+
+int64_t typematic_deadline(const typematic_t *tm)
+{
+  if (0 == tm->chord || tm->stopped)
+    return -1;
+  return tm->held_since + tm->delay_us + (int64_t) tm->typed * tm->interval_us;
+}
+
+bool typematic_due(typematic_t *tm, int64_t now)
+{
+  int64_t deadline = typematic_deadline(tm);
+  if (-1 == deadline || now < deadline)
+    return false;
+  // On to the first slot after now, skipping any that have been missed:
+  tm->typed = 1 + (uint32_t) ((now - tm->held_since - tm->delay_us) / tm->interval_us);
+  return true;
+}
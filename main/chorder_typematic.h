@@ -0,0 +1,46 @@
+#ifndef _CHORDER_TYPEMATIC_H_
+#define _CHORDER_TYPEMATIC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Typematic (auto)repeat: a chord held still for the delay is typed there and
+ * then, rather than on release, and again every interval for as long as it's
+ * still held. Letting go of it afterwards types nothing more.
+ *
+ * Repeats are due at fixed offsets from when the chord was last changed, not
+ * from when the one before went out, so a late wake-up delays one repeat
+ * without slowing the rate down. Repeats missed altogether are skipped,
+ * rather than sent in a burst. The decoder is woken for typematic_deadline()
+ * by an esp_timer.
+ */
+typedef struct {
+  int32_t delay_us;
+  int32_t interval_us;
+  uint8_t chord;                           // chord held still, or 0
+  int64_t held_since;
+  uint32_t typed;                          // times it's been typed so far
+  bool stopped;                            // typed, but not to be repeated
+} typematic_t;
+
+void typematic_init(typematic_t *tm, int32_t delay_us, int32_t interval_us);
+
+/* Follows the chord held still since the given time, or 0 if none is.
+ * Returns the chord it replaces if that was typed, so that its commit on
+ * release can be dropped; 0 otherwise.
+ */
+uint8_t typematic_hold(typematic_t *tm, uint8_t chord, int64_t since);
+
+// When the chord held is next due to be typed, or -1 if it isn't:
+int64_t typematic_deadline(const typematic_t *tm);
+
+// Whether the chord held is due to be typed by now; if so, counts it typed:
+bool typematic_due(typematic_t *tm, int64_t now);
+
+// Stops repeating the chord held, e.g. once it turns out not to repeat:
+static inline void typematic_stop(typematic_t *tm)
+{
+  tm->stopped = true;
+}
+
+#endif
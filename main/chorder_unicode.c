@@ -0,0 +1,133 @@
+#include "esp_log.h"
+
+#include "hid_dev.h"
+#include "chorder_locale.h"
+#include "chorder_unicode.h"
+
+#define MOD_CTRL  0x01
+#define MOD_SHIFT 0x02
+#define MOD_ALT   0x04
+
+uint8_t unicode_method = UNICODE_NONE;
+
+static const char *const method_names[UNICODE_METHODS] = {
+  [UNICODE_NONE] = "none",
+  [UNICODE_LINUX] = "Linux",
+  [UNICODE_MACOS] = "macOS",
+  [UNICODE_WINDOWS] = "Windows",
+};
+
+bool unicode_select(uint8_t method)
+{
+  if (method >= UNICODE_METHODS) {
+    ESP_LOGE(__FUNCTION__, "No Unicode input method %u; keeping %s", method, method_names[unicode_method]);
+    return false;
+  }
+  unicode_method = method;
+  ESP_LOGI(__FUNCTION__, "Unicode input method: %s", method_names[unicode_method]);
+  return true;
+}
+
+typedef struct {
+  unicode_report_t *reports;
+  size_t len;
+  uint8_t held_mod;                        // held down throughout, e.g. Option
+} sequence_t;
+
+// Presses key, with the modifiers held on top; a key that's down already is
+// let go of first, or the host would see nothing new:
+static void press(sequence_t *seq, uint8_t mod, uint8_t key)
+{
+  if (0 != seq->len && key == seq->reports[seq->len - 1].key)
+    seq->reports[seq->len++] = (unicode_report_t) { seq->held_mod, 0 };
+  seq->reports[seq->len++] = (unicode_report_t) { seq->held_mod | mod, key };
+}
+
+static void release_all(sequence_t *seq)
+{
+  seq->reports[seq->len++] = (unicode_report_t) { 0x00, 0 };
+}
+
+// Types c as the host's layout has it; false if it has no plain key for it:
+static bool press_char(sequence_t *seq, char c)
+{
+  const locale_stroke_t *stroke = locale_lookup((unsigned char) c);
+  if (NULL == stroke || 0 != stroke->dead_key)
+    return false;
+  press(seq, stroke->mod, stroke->key);
+  return true;
+}
+
+// Hex digits for Option-hex entry, which goes by the US layout whatever the
+// host's is:
+static void press_us_hex(sequence_t *seq, uint16_t value)
+{
+  for (int shift = 12; shift >= 0; shift -= 4) {
+    uint8_t digit = (value >> shift) & 0xF;
+    press(seq, 0x00, 0 == digit ? HID_KEY_0 : digit < 10 ? HID_KEY_1 + digit - 1 : HID_KEY_A + digit - 10);
+  }
+}
+
+static const char hex_digits[] = "0123456789abcdef";
+
+// Where the leading hex digit of codepoint is, as a shift:
+static int leading_digit(uint32_t codepoint)
+{
+  int shift = 20;
+  while (shift > 0 && 0 == (codepoint >> shift & 0xF))
+    shift -= 4;
+  return shift;
+}
+
+size_t unicode_reports(uint32_t codepoint, unicode_report_t reports[UNICODE_MAX_REPORTS])
+{
+  sequence_t seq = { .reports = reports, .len = 0, .held_mod = 0x00 };
+  if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+    return 0;
+
+  switch (unicode_method) {
+    case UNICODE_LINUX: {
+      press(&seq, MOD_CTRL | MOD_SHIFT, HID_KEY_U);
+      release_all(&seq);
+      for (int shift = leading_digit(codepoint); shift >= 0; shift -= 4) {
+        if (!press_char(&seq, hex_digits[codepoint >> shift & 0xF]))
+          return 0;
+      }
+      if (!press_char(&seq, ' '))
+        return 0;
+      break;
+    }
+
+    case UNICODE_MACOS:
+      seq.held_mod = MOD_ALT;
+      if (codepoint > 0xFFFF) {
+        press_us_hex(&seq, 0xD800 + ((codepoint - 0x10000) >> 10));
+        press_us_hex(&seq, 0xDC00 + ((codepoint - 0x10000) & 0x3FF));
+      } else {
+        press_us_hex(&seq, codepoint);
+      }
+      break;
+
+    case UNICODE_WINDOWS:
+      if (codepoint > 0xFFFF)
+        return 0;
+      // Digits on the keypad, letters wherever the host's layout has them:
+      seq.held_mod = MOD_ALT;
+      press(&seq, 0x00, HID_KEY_ADD);
+      for (int shift = leading_digit(codepoint); shift >= 0; shift -= 4) {
+        uint8_t digit = codepoint >> shift & 0xF;
+        if (digit >= 10) {
+          if (!press_char(&seq, hex_digits[digit]))
+            return 0;
+        } else {
+          press(&seq, 0x00, 0 == digit ? HID_KEYPAD_0 : HID_KEYPAD_1 + digit - 1);
+        }
+      }
+      break;
+
+    default:
+      return 0;
+  }
+  release_all(&seq);
+  return seq.len;
+}
@@ -0,0 +1,49 @@
+#ifndef _CHORDER_UNICODE_H_
+#define _CHORDER_UNICODE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Typing characters the host's layout has no key for, through its Unicode
+ * input method, as picked by the "unicode" NVS setting:
+ *
+ * - Linux (IBus, GTK): Ctrl+Shift+U, the code point in hex, space. Hex
+ *   digits are typed in the host's layout.
+ * - macOS, with the "Unicode Hex Input" input source: Option held down over
+ *   the code point as four hex digits, or two lots of four (UTF-16).
+ * - Windows, with EnableHexNumpad set in the registry: Alt held down over
+ *   keypad +, then the code point in hex. Only goes up to U+FFFF.
+ *
+ * A character comes out as a sequence of keyboard reports, meant to go out
+ * back to back, that ends with all keys up.
+ */
+enum unicode_method {
+  UNICODE_NONE,                            // characters without a key are skipped
+  UNICODE_LINUX,
+  UNICODE_MACOS,
+  UNICODE_WINDOWS,
+  UNICODE_METHODS,
+};
+
+typedef struct {
+  uint8_t mod;                             // modifier byte, as in the HID report
+  uint8_t key;                             // 0 for no key down
+} unicode_report_t;
+
+// Longest sequence there is: a UTF-16 surrogate pair for macOS, with each
+// digit repeated, and so released in between:
+#define UNICODE_MAX_REPORTS 16
+
+extern uint8_t unicode_method;
+
+// Picks the method to type with, by enum unicode_method; false, leaving it
+// be, if there's no such method:
+bool unicode_select(uint8_t method);
+
+/* Puts the reports that type codepoint into reports, and returns how many
+ * there are; 0 if the method can't type it, or there's no method.
+ */
+size_t unicode_reports(uint32_t codepoint, unicode_report_t reports[UNICODE_MAX_REPORTS]);
+
+#endif
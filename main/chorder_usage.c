@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+#include "chorder_usage.h"
+
+usage_t usage;
+
+static portMUX_TYPE usage_dirty_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool usage_available = false;
+
+void usage_load(void)
+{
+  esp_err_t ret = nvs_flash_init_partition(USAGE_PARTITION);
+  if (ESP_ERR_NVS_NO_FREE_PAGES == ret || ESP_ERR_NVS_NEW_VERSION_FOUND == ret) {
+    ESP_LOGW(__FUNCTION__, "Erasing the %s partition; usage stats start over", USAGE_PARTITION);
+    nvs_flash_erase_partition(USAGE_PARTITION);
+    ret = nvs_flash_init_partition(USAGE_PARTITION);
+  }
+  if (ESP_OK != ret) {
+    ESP_LOGE(__FUNCTION__, "No %s partition (%s); usage stats won't be kept", USAGE_PARTITION, esp_err_to_name(ret));
+    return;
+  }
+  usage_available = true;
+
+  nvs_handle_t handle;
+  if (ESP_OK != nvs_open_from_partition(USAGE_PARTITION, "usage", NVS_READONLY, &handle))
+    return;  // nothing written yet
+  size_t size = sizeof(usage.chords);
+  if (ESP_OK != nvs_get_blob(handle, "chords", usage.chords, &size) || sizeof(usage.chords) != size)
+    memset(usage.chords, 0, sizeof(usage.chords));
+  for (unsigned block = 0; block < USAGE_BLOCKS; block++) {
+    char key[8];
+    snprintf(key, sizeof(key), "trans%u", block);
+    uint16_t (*rows)[KEYMAP_CHORDS] = &usage.transitions[block * USAGE_BLOCK_ROWS];
+    size = USAGE_BLOCK_ROWS * sizeof(usage.transitions[0]);
+    if (ESP_OK != nvs_get_blob(handle, key, rows, &size) || USAGE_BLOCK_ROWS * sizeof(usage.transitions[0]) != size)
+      memset(rows, 0, USAGE_BLOCK_ROWS * sizeof(usage.transitions[0]));
+  }
+  nvs_close(handle);
+}
+
+void usage_flush(void)
+{
+  if (!usage_available)
+    return;
+  portENTER_CRITICAL(&usage_dirty_lock);
+  uint32_t dirty = usage.dirty;
+  usage.dirty = 0;
+  portEXIT_CRITICAL(&usage_dirty_lock);
+  if (0 == dirty)
+    return;
+
+  nvs_handle_t handle;
+  esp_err_t ret = nvs_open_from_partition(USAGE_PARTITION, "usage", NVS_READWRITE, &handle);
+  if (ESP_OK == ret && (dirty & USAGE_DIRTY_CHORDS))
+    ret = nvs_set_blob(handle, "chords", usage.chords, sizeof(usage.chords));
+  unsigned blocks = 0;
+  for (unsigned block = 0; ESP_OK == ret && block < USAGE_BLOCKS; block++) {
+    if (!(dirty & (1UL << block)))
+      continue;
+    char key[8];
+    snprintf(key, sizeof(key), "trans%u", block);
+    ret = nvs_set_blob(handle, key, &usage.transitions[block * USAGE_BLOCK_ROWS],
+        USAGE_BLOCK_ROWS * sizeof(usage.transitions[0]));
+    blocks++;
+  }
+  if (ESP_OK == ret)
+    ret = nvs_commit(handle);
+  nvs_close(handle);
+
+  if (ESP_OK != ret) {
+    ESP_LOGE(__FUNCTION__, "Cannot write usage stats (%s); will retry", esp_err_to_name(ret));
+    portENTER_CRITICAL(&usage_dirty_lock);
+    usage.dirty |= dirty;
+    portEXIT_CRITICAL(&usage_dirty_lock);
+    return;
+  }
+  ESP_LOGI(__FUNCTION__, "Usage stats written; %u of %u transition blocks had changed", blocks, USAGE_BLOCKS);
+}
+
+void usage_dump(void)
+{
+  for (unsigned layer = 0; layer < KEYMAP_LAYERS; layer++) {
+    for (unsigned chord = 0; chord < KEYMAP_CHORDS; chord++) {
+      if (0 != usage.chords[layer][chord])
+        printf(USAGE_CHORD_PREFIX "%u %02x %u\n", layer, chord, usage.chords[layer][chord]);
+    }
+  }
+  for (unsigned previous = 0; previous < KEYMAP_CHORDS; previous++) {
+    for (unsigned next = 0; next < KEYMAP_CHORDS; next++) {
+      if (0 != usage.transitions[previous][next])
+        printf(USAGE_TRANSITION_PREFIX "%02x %02x %u\n", previous, next, usage.transitions[previous][next]);
+    }
+  }
+  fflush(stdout);
+}
@@ -0,0 +1,55 @@
+#ifndef _CHORDER_USAGE_H_
+#define _CHORDER_USAGE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "chorder_keymap.h"
+
+/* Chord usage statistics, for tuning layouts with: how often each chord is
+ * typed on each layer, and how often each chord follows each other chord.
+ * Counters are 16 bits and saturate. Chord 0 is never typed, so the row for
+ * it counts what chords start a session.
+ *
+ * Counting is a couple of increments in RAM. The counts are kept in their
+ * own NVS partition, and are only written out by usage_flush(), which only
+ * writes the blocks of the transition matrix that have changed since.
+ */
+#define USAGE_PARTITION       "usage"
+#define USAGE_BLOCK_ROWS      16
+#define USAGE_BLOCKS          (KEYMAP_CHORDS / USAGE_BLOCK_ROWS)
+#define USAGE_DIRTY_CHORDS    (1UL << USAGE_BLOCKS)
+
+// Dump lines, to be picked out of a console log on the host:
+#define USAGE_CHORD_PREFIX      "UC "        // UC <layer> <chord> <count>
+#define USAGE_TRANSITION_PREFIX "UT "        // UT <previous> <next> <count>
+
+typedef struct {
+  uint16_t chords[KEYMAP_LAYERS][KEYMAP_CHORDS];
+  uint16_t transitions[KEYMAP_CHORDS][KEYMAP_CHORDS];  // [previous][next], on any layer
+  uint8_t previous;                        // the last chord counted
+  uint32_t dirty;                          // bit per transition block, and USAGE_DIRTY_CHORDS
+} usage_t;
+
+extern usage_t usage;
+
+static inline void usage_count(uint8_t layer, uint8_t chord)
+{
+  uint16_t *count = &usage.chords[layer][chord];
+  uint16_t *transition = &usage.transitions[usage.previous][chord];
+  *count += UINT16_MAX != *count;
+  *transition += UINT16_MAX != *transition;
+  // Unlocked; should a flush clear this bit right after, the block just waits
+  // for the next one:
+  usage.dirty |= USAGE_DIRTY_CHORDS | (1UL << (usage.previous / USAGE_BLOCK_ROWS));
+  usage.previous = chord;
+}
+
+// Reads counts back in from NVS; to be called before anything is counted:
+void usage_load(void);
+// Writes out what's changed since the last flush; cheap if nothing has:
+void usage_flush(void);
+// Prints all non-zero counters to the console:
+void usage_dump(void);
+
+#endif
@@ -29,6 +29,7 @@
 typedef struct config_data {
     char bt_device_name[MAX_BT_DEVICENAME_LENGTH];
     uint8_t locale;
+    uint8_t unicode;
 } config_data_t;
 
 #define INTERNAL_BUFSIZE 200
@@ -53,6 +54,15 @@ typedef struct config_data {
 #define MIDDLE_PIN   GPIO_NUM_25
 #define RING_PIN     GPIO_NUM_26
 #define PINKY_PIN    GPIO_NUM_27
+// Release debounce windows per key, in microseconds. Presses are taken
+// without delay; see chorder_debounce.h.
+#define F_THUMB_DEBOUNCE_US  CONFIG_CHORDER_DEBOUNCE_US
+#define C_THUMB_DEBOUNCE_US  CONFIG_CHORDER_DEBOUNCE_US
+#define N_THUMB_DEBOUNCE_US  CONFIG_CHORDER_DEBOUNCE_US
+#define INDEX_DEBOUNCE_US    CONFIG_CHORDER_DEBOUNCE_US
+#define MIDDLE_DEBOUNCE_US   CONFIG_CHORDER_DEBOUNCE_US
+#define RING_DEBOUNCE_US     CONFIG_CHORDER_DEBOUNCE_US
+#define PINKY_DEBOUNCE_US    CONFIG_CHORDER_DEBOUNCE_US
 // GND pins by means of output 0. (Too lazy to solder a massive 1-to-7
 // GND dupont wire. 🙃)
 #define GND_PIN0 GPIO_NUM_21
@@ -18,6 +18,8 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "esp_log.h"
+#include "hidd_le_prf_int.h"
+#include "chorder_hidtx.h"
 
 static hid_report_map_t *hid_dev_rpt_tbl;
 static uint8_t hid_dev_rpt_tbl_Len;
@@ -49,9 +51,25 @@ void hid_dev_send_report(esp_gatt_if_t gatts_if, uint16_t conn_id,
 
     // get att handle for report
     if ((p_rpt = hid_dev_rpt_by_id(id, type)) != NULL) {
-        // if notifications are enabled
-        ESP_LOGD(HID_LE_PRF_TAG, "%s(), send the report, handle = %d", __func__, p_rpt->handle);
-        esp_ble_gatts_send_indicate(gatts_if, conn_id, p_rpt->handle, length, data, false);
+        if (length > HID_TX_REPORT_MAX_LEN) {
+            ESP_LOGE(HID_LE_PRF_TAG, "%s(), report of %d bytes is too long to queue", __func__, length);
+            return;
+        }
+        // Sent on by the transmit queue, paced to what the link takes:
+        ESP_LOGD(HID_LE_PRF_TAG, "%s(), queue the report, handle = %d", __func__, p_rpt->handle);
+        hid_tx_report_t report = {
+            .gatts_if = gatts_if,
+            .conn_id = conn_id,
+            .handle = p_rpt->handle,
+            .len = length,
+        };
+        memcpy(report.data, data, length);
+        // A mouse report may move it with no button down; any other report
+        // holds nothing down once it's all zeroes:
+        report.keys_up = true;
+        for (uint8_t i = 0; i < (HID_RPT_ID_MOUSE_IN == id ? 1 : length); i++)
+            report.keys_up = report.keys_up && 0 == data[i];
+        hid_tx_queue(&report);
     }
     
     return;
@@ -76,6 +76,7 @@ extern "C" {
 #define HID_KEY_LEFT_BRKT      47   // Keyboard [ and {
 #define HID_KEY_RIGHT_BRKT     48   // Keyboard ] and }
 #define HID_KEY_BACK_SLASH     49   // Keyboard \ and |
+#define HID_KEY_NONUS_HASH     50   // Keyboard Non-US # and ~ (ISO, next to Return)
 #define HID_KEY_SEMI_COLON     51   // Keyboard ; and :
 #define HID_KEY_SGL_QUOTE      52   // Keyboard ' and "
 #define HID_KEY_GRV_ACCENT     53   // Keyboard Grave Accent and Tilde
@@ -125,6 +126,7 @@ extern "C" {
 #define HID_KEYPAD_9           97   // Keypad 9 and PageUp
 #define HID_KEYPAD_0           98   // Keypad 0 and Insert
 #define HID_KEYPAD_DOT         99   // Keypad . and Delete
+#define HID_KEY_NONUS_BACK_SLASH 100 // Keyboard Non-US \ and | (ISO, next to left shift)
 #define HID_KEY_MUTE           127  // Keyboard Mute
 #define HID_KEY_VOLUME_UP      128  // Keyboard Volume up
 #define HID_KEY_VOLUME_DOWN    129  // Keyboard Volume down
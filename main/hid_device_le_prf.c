@@ -15,6 +15,9 @@
 #include "hidd_le_prf_int.h"
 #include <string.h>
 #include "esp_log.h"
+#include "sdkconfig.h"
+#include "chorder_hidtx.h"
+#include "chorder_connparams.h"
 
 /// characteristic presentation information
 struct prf_char_pres_fmt
@@ -578,6 +581,11 @@ void esp_hidd_prf_cb_hdl(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
 			memcpy(cb_param.connect.remote_bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
             cb_param.connect.conn_id = param->connect.conn_id;
             hidd_clcb_alloc(param->connect.conn_id, param->connect.remote_bda);
+            // In units of 1.25 ms, until the host asks for another:
+            hid_tx_set_interval(param->connect.conn_params.interval * 1250);
+#if CONFIG_CHORDER_CONN_PARAMS
+            connparams_connected(param->connect.remote_bda, &param->connect.conn_params);
+#endif
             esp_ble_set_encryption(param->connect.remote_bda, ESP_BLE_SEC_ENCRYPT_MITM);
             if(hidd_le_env.hidd_cb != NULL) {
                 (hidd_le_env.hidd_cb)(ESP_HIDD_EVENT_BLE_CONNECT, &cb_param);
@@ -29,55 +29,36 @@
 
 #include "chorder_display.h"
 #include "chorder_wifi.h"
+#include "chorder_keyscan.h"
+#include "chorder_debounce.h"
+#include "chorder_keyring.h"
+#include "chorder_latency.h"
+#include "chorder_chord.h"
+#include "chorder_trace.h"
+#include "chorder_keymap_partition.h"
+#include "chorder_snippets.h"
+#include "chorder_dict.h"
+#include "chorder_taphold.h"
+#include "chorder_usage.h"
+#include "chorder_advisor.h"
+#include "chorder_locale.h"
+#include "chorder_typematic.h"
+#include "chorder_unicode.h"
+#include "chorder_hidtx.h"
+#include "chorder_connparams.h"
 
 #include "driver/gpio.h"
 #include "driver/rtc_io.h"
+#include "soc/gpio_reg.h"
 #include "fontx.h"
 #include "bmpfile.h"
 #include "decode_image.h"
 #include "pngle.h"
 
-#include "chordmappings.h"
+#include "chorder_handlers.h"
 
 
 
-////////////////////////////////////////////////////////////////////////////////
-// For keyboard functionality per se
-////////////////////////////////////////////////////////////////////////////////
-// {{{
-
-enum State {
-  PRESSING,
-  RELEASING,
-};
-
-
-enum Mode {
-  ALPHA,
-  NUMSYM,
-  FUNCTION
-};
-
-enum Operating_mode {
-  OPMODE_NOTETAKING,
-  OPMODE_BLE_KEYBOARD,
-  OPMODE_BLE_MOUSE,
-};
-
-// the current function that'll take keystate updates:
-// This receives a shifted-into-place bit string of the latest key press
-void (*keystate_handler)(uint8_t keyState);
-
-
-bool isCapsLocked = false;
-bool isNumsymLocked = false;
-keymap_t modKeys = 0x00;
-
-enum Mode mode = ALPHA;
-
-
-// }}}
-
 ////////////////////////////////////////////////////////////////////////////////
 // Configuration relevant to bluetooth functionality
 ////////////////////////////////////////////////////////////////////////////////
@@ -97,8 +78,6 @@ enum Mode mode = ALPHA;
 #error "Sorry, currently the BT controller of the ESP32 does NOT support whitelisting. Please deactivate the pairing on demand option in make menuconfig!"
 #endif
 
-static uint16_t hid_conn_id = 0;
-static bool sec_conn = false;
 #define CHAR_DECLARATION_SIZE   (sizeof(uint8_t))
 
 static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *param);
@@ -218,6 +197,10 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
                                          }
         case ESP_HIDD_EVENT_BLE_DISCONNECT: {
                                                 sec_conn = false;
+                                                hid_tx_set_connected(false);
+#if CONFIG_CHORDER_CONN_PARAMS
+                                                connparams_disconnected();
+#endif
                                                 lcd_state.bluetooth_connected = false;
                                                 ESP_LOGI(__FUNCTION__, "ESP_HIDD_EVENT_BLE_DISCONNECT");
                                                 esp_ble_gap_start_advertising(&hidd_adv_params);
@@ -314,6 +297,7 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
             if(!param->ble_security.auth_cmpl.success) {
                 ESP_LOGE(__FUNCTION__, "fail reason = 0x%x",param->ble_security.auth_cmpl.fail_reason);
             } else {
+                hid_tx_set_connected(true);
                 xEventGroupClearBits(eventgroup_system,SYSTEM_CURRENTLY_ADVERTISING);
             }
 #if CONFIG_MODULE_BT_PAIRING
@@ -328,6 +312,21 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
             {
                 ESP_LOGW(__FUNCTION__,"cannot add device to whitelist, with random address");
             }
+#endif
+            break;
+        case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+            // In units of 1.25 ms; reports are paced to it:
+            if (ESP_BT_STATUS_SUCCESS == param->update_conn_params.status)
+                hid_tx_set_interval(param->update_conn_params.conn_int * 1250);
+#if CONFIG_CHORDER_CONN_PARAMS
+            {
+                esp_gap_conn_params_t accepted = {
+                    .interval = param->update_conn_params.conn_int,
+                    .latency = param->update_conn_params.latency,
+                    .timeout = param->update_conn_params.timeout,
+                };
+                connparams_updated(ESP_BT_STATUS_SUCCESS == param->update_conn_params.status, &accepted);
+            }
 #endif
             break;
         default:
@@ -346,6 +345,9 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 void send_chorder_to_sleep (void)
 {
   ESP_LOGI(__FUNCTION__,"Entering deep sleep now...");
+#if CONFIG_CHORDER_USAGE_STATS
+  usage_flush();
+#endif
   lcdBacklightOff(&dev);
   lcdDisplayOff(&dev);
   lcdSleep(&dev);
@@ -394,32 +396,6 @@ void send_chorder_to_sleep (void)
   esp_deep_sleep_start();
 }
 
-bool urlencode_into(char *dest, size_t max_dest, const char *unescaped)
-{
-  char *outpos = dest;
-  for(int i=0;i<strlen(unescaped);i++)
-  {
-    char addition[4];
-    if (
-        ('A' <= unescaped[i] && unescaped[i] <= 'Z') ||
-        ('a' <= unescaped[i] && unescaped[i] <= 'z') ||
-        ('0' <= unescaped[i] && unescaped[i] <= '9') ||
-        '-' == unescaped[i] ||
-        '_' == unescaped[i] ||
-        '.' == unescaped[i] ||
-        '~' == unescaped[i])
-    {
-      sprintf(addition,"%c",unescaped[i]);
-    } else {
-      sprintf(addition,"%%%02x",unescaped[i]);
-    }
-    int written = snprintf(outpos,max_dest-(outpos-dest),"%s",addition);
-    if (written != strlen(addition))
-      return false;
-    outpos += written;
-  }
-  return true;
-}
 
 
 bool send_off_note(char *note)
@@ -500,7 +476,6 @@ bool send_off_note(char *note)
     return false;
   }
 }
-void switch_to_opmode(enum Operating_mode target);
 
 void set_up_input_pin (int pinnum)
 {
@@ -533,437 +508,96 @@ void set_up_gnd_pin (int pinnum)
     }
     ESP_LOGI(__FUNCTION__,"Successfully set up software GND pin %d", pinnum);
 }
-uint8_t get_current_state ()
-{
-    uint8_t state = 0;
-    state |= (!gpio_get_level(F_THUMB_PIN) << 6);
-    state |= (!gpio_get_level(C_THUMB_PIN) << 5);
-    state |= (!gpio_get_level(N_THUMB_PIN) << 4);
-    state |= (!gpio_get_level(INDEX_PIN)   << 3);
-    state |= (!gpio_get_level(MIDDLE_PIN)  << 2);
-    state |= (!gpio_get_level(RING_PIN)    << 1);
-    state |= (!gpio_get_level(PINKY_PIN)   << 0);
-    return state;
-}
 
-void release_keys(){
-  uint8_t buf[8];
-  memset(buf,0x00,8);
-  esp_hidd_send_keyboard_value(hid_conn_id,0x00,buf,1);
-}
-
-void sendRawKey(uint8_t modKey, uint8_t rawKey){
-  uint8_t buf[8];
-  memset(buf,0x00,8);
-  buf[0] = rawKey;
-  esp_hidd_send_keyboard_value(hid_conn_id,modKey,buf,1);
-  ESP_LOGD("sendRawKey","esp_hidd_send_keyboard_value(%d,0x%x,0x%x %x %x %x %x %x %x %x)",
-      hid_conn_id,modKey,
-      buf[0],buf[1],buf[2],buf[3],
-      buf[4],buf[5],buf[6],buf[7]);
-  release_keys();
-}
+#if CONFIG_CHORDER_KEYSCAN_INTERRUPT
+// The task to notify upon key edges, and the time of the most recent edge
+// per keyState bit:
+static TaskHandle_t key_scan_task = NULL;
+static int64_t last_edge_time[DEBOUNCE_KEYS];
+static portMUX_TYPE last_edge_time_mux = portMUX_INITIALIZER_UNLOCKED;
 
-void sendControlKey(char *cntrlName){
-  // note: for Volume +/- and the few other keys that take a time to hold, simply add it into the string
-  // for example:
-  //    sendControlKey("VOLUME+,500")
-  // will send Volume up and hold it for half a second
-  //ble.print("AT+BLEHIDCONTROLKEY=");
-  //ble.println(cntrlName);  
-}  
-
-bool opmode_switch_and_deepsleep_handler (uint8_t keyState)
+static void IRAM_ATTR key_edge_isr_handler (void *arg)
 {
-  symbol_t symbol = keymap[keyState][0];
-  switch (symbol) {
-    case MODE_BLE_KEYBOARD:
-      switch_to_opmode(OPMODE_BLE_KEYBOARD);
-      return true;
-    case MODE_BLE_MOUSE:
-      switch_to_opmode(OPMODE_BLE_MOUSE);
-      return true;
-    case MODE_NOTETAKING:
-      switch_to_opmode(OPMODE_NOTETAKING);
-      return true;
-    case MODE_DEEPSLEEP:
-      strcpy(lcd_state.success,"Entering deep sleep now...");
-      vTaskDelay(2000 / portTICK_PERIOD_MS);
-      send_chorder_to_sleep();
-      return true; // oughtn't actually matter; however, warnings
-    default:
-      return false;
-  }
-}
-
-/* Redirector, so that the core logic (shifted not shifted) can be managed
- * centrally:
- */
-void handle_keystate_update_internally(uint8_t keyState, void (*symbol_handler)(symbol_t input))
-{
-  static bool is_shifted = false;
-  static bool is_numsymed = false;
-
-  display_timeout_last_activity = xTaskGetTickCount();
-  symbol_t symbol = keymap[keyState][is_numsymed ? 6 : (is_shifted? 4 : 5)];
-
-  switch (symbol) {
-    case MOD_LSHIFT:
-      is_shifted = !is_shifted;
-      //is_numsymed = false;
-      return;
-    case MOD_RSHIFT:
-      is_shifted = !is_shifted;
-      //is_numsymed = false;
-      return;
-    case MODE_NUM:
-      //is_shifted = false;
-      is_numsymed = true;
-      return;
-    default:
-      (*symbol_handler)(symbol);
-      is_shifted = false;
-      is_numsymed = false;
-  }
-}
+  BaseType_t higher_priority_task_woken = pdFALSE;
+  int keybit = (intptr_t) arg;
 
-void printing_handler(symbol_t symbol){
-  static bool initialised = false;
-
-  if (!initialised)
-  {
-    lcd_state.message[0] = '\0';
-    lcd_state.alert[0] = '\0';
-    initialised = true;
-  }
-  
-  switch (symbol) {
-    case NONBLE_BACKSPACE:
-      lcd_state.message[0 == strlen(lcd_state.message) ? 0 : strlen(lcd_state.message)-1] = '\0';
-      break;
-    case '\n': // sending on enter key presses:
-      if (send_off_note(lcd_state.message)) {
-        strcpy(lcd_state.success,"Sent note off");
-        strcpy(lcd_state.message,"");
-      } else {
-        strcpy(lcd_state.alert,"Couldn't send note!");
-      }
-      break;
-    default:
-      if (symbol < 128) {
-        // Reset alert:
-        lcd_state.alert[0] = '\0';
-
-        // Keep replacing the last character if we're at the buffer size:
-        size_t pos = ((strlen(lcd_state.message) >= INTERNAL_BUFSIZE - 1) ? strlen(lcd_state.message)-1 : strlen(lcd_state.message));
-        lcd_state.message[pos] = (char) symbol;
-        lcd_state.message[pos+1] = '\0';
-      } else {
-        sprintf((char *)lcd_state.alert,"Special: %u",symbol);
-      }
-      break;
-  }
+  portENTER_CRITICAL_ISR(&last_edge_time_mux);
+  last_edge_time[keybit] = esp_timer_get_time();
+  portEXIT_CRITICAL_ISR(&last_edge_time_mux);
 
+  vTaskNotifyGiveFromISR(key_scan_task, &higher_priority_task_woken);
+  if (higher_priority_task_woken)
+    portYIELD_FROM_ISR();
 }
 
-void handle_keystate_update_internally_with_printing(uint8_t keyState){
-  handle_keystate_update_internally(keyState,&printing_handler);
+void get_last_edge_times (int64_t edge_times[DEBOUNCE_KEYS])
+{
+  portENTER_CRITICAL(&last_edge_time_mux);
+  memcpy(edge_times, last_edge_time, sizeof(last_edge_time));
+  portEXIT_CRITICAL(&last_edge_time_mux);
 }
 
-void handle_keystate_update_as_ble_keyboard(uint8_t keyState){
-
-  display_timeout_last_activity = xTaskGetTickCount();
-
-  keymap_t theKey;  
-  // Determine the key based on the current mode's keymap
-  if (mode == ALPHA) {
-    theKey = keymap[keyState][0];
-  } else if (mode == NUMSYM) {
-    theKey = keymap[keyState][1];
-  } else {
-    theKey = keymap[keyState][2];
-  }
-
-  switch (theKey)  {
-  // Handle mode switching - return immediately after the mode has changed
-  // Handle basic mode switching
-  case MODE_NUM:
-    if (mode == NUMSYM) {
-      mode = ALPHA;
-    } else {
-      mode = NUMSYM;
-    }
-    return;
-  case MODE_FUNC:
-    if (mode == FUNCTION) {
-      mode = ALPHA;
-    } else {
-      mode = FUNCTION;
-    }
-    return;
-  case MODE_RESET:
-    mode = ALPHA;
-    modKeys = 0x00;
-    isCapsLocked = false;
-    isNumsymLocked = false;
-    return;
-  case MODE_MRESET:
-    mode = ALPHA;
-    modKeys = 0x00;
-    isCapsLocked = false;
-    isNumsymLocked = false;       
-    //digitalWrite(EnPin, LOW);  // turn off 3.3v regulator enable.
-    return;
-  // Handle mode locks
-  case HID_KEY_CAPS_LOCK:
-    if (isCapsLocked){
-      isCapsLocked = false;
-      modKeys = 0x00;
-    } else {
-      isCapsLocked = true;
-      modKeys = 0x02;
-    }
-    return;
-  case MODE_NUMLCK:
-    if (isNumsymLocked){
-      isNumsymLocked = false;
-      mode = ALPHA;
-    } else {
-      isNumsymLocked = true;
-      mode = NUMSYM;
+void set_up_input_pin_interrupt (int pinnum, int keybit)
+{
+    if (ESP_OK != gpio_set_intr_type(pinnum, GPIO_INTR_ANYEDGE))
+    {
+        ESP_LOGE(__FUNCTION__,"Failure setting pin %d's interrupt type", pinnum);
+        return;
     }
-    return;
-  // Handle modifier keys toggling
-  case MOD_LCTRL:
-    modKeys = modKeys ^ 0x01;
-    return;
-  case MOD_LSHIFT:
-    modKeys = modKeys ^ 0x02;
-    return;
-  case MOD_LALT:
-    modKeys = modKeys ^ 0x04;
-    return;
-  case MOD_LGUI:
-    modKeys = modKeys ^ 0x08;
-    return;
-  case MOD_RCTRL:
-    modKeys = modKeys ^ 0x10;
-    return;
-  case MOD_RSHIFT:
-    modKeys = modKeys ^ 0x20;
-    return;
-  case MOD_RALT:
-    modKeys = modKeys ^ 0x40;
-    return;
-  case MOD_RGUI:
-    modKeys = modKeys ^ 0x80;
-    return;
-  // Handle special keys
-  case MULTI_NumShift:
-    if (mode == NUMSYM) {
-      mode = ALPHA;
-    } else {
-      mode = NUMSYM;
+    if (ESP_OK != gpio_isr_handler_add(pinnum, key_edge_isr_handler, (void *) (intptr_t) keybit))
+    {
+        ESP_LOGE(__FUNCTION__,"Failure adding pin %d's interrupt handler", pinnum);
+        return;
     }
-    modKeys = modKeys ^ 0x02;
-    return;
-  case MULTI_CtlAlt:
-    modKeys = modKeys ^ 0x01;
-    modKeys = modKeys ^ 0x04;
-    return;
-  /* Everything after this sends actual keys to the system; break rather than
-     return since we want to reset the modifiers after these keys are sent. */
-  case MACRO_000:
-    sendRawKey(0x00, 0x27);
-    sendRawKey(0x00, 0x27);
-    sendRawKey(0x00, 0x27);
-    break;
-  case MACRO_00:
-    sendRawKey(0x00, 0x27);
-    sendRawKey(0x00, 0x27);
-    break;
-  case MACRO_quotes:
-    sendRawKey(0x02, 0x34);
-    sendRawKey(0x02, 0x34);
-    sendRawKey(0x00, 0x50);
-    break;
-  case MACRO_parens:
-    sendRawKey(0x02, 0x26);
-    sendRawKey(0x02, 0x27);
-    sendRawKey(0x00, 0x50);
-    break;
-  case MACRO_dollar:
-    sendRawKey(0x02, 0x21);
-    break;
-  case MACRO_percent:
-    sendRawKey(0x02, 0x22);
-    break;
-  case MACRO_ampersand:
-    sendRawKey(0x02, 0x24);
-    break;
-  case MACRO_asterisk:
-    sendRawKey(0x02, 0x25);
-    break;
-  case MACRO_question:
-    sendRawKey(0x02, 0x38);
-    break;
-  case MACRO_plus:
-    sendRawKey(0x02, 0x2E);
-    break;
-  case MACRO_openparen:
-    sendRawKey(0x02, 0x26);
-    break;
-  case MACRO_closeparen:
-    sendRawKey(0x02, HID_KEY_0);
-    break;
-  case MACRO_opencurly:
-    sendRawKey(0x02, 0x2F);
-    break;
-  case MACRO_closecurly:
-    sendRawKey(0x02, 0x30);
-    break;
-  // Handle Android specific keys
-  case ANDROID_search:
-    sendRawKey(0x04, 0x2C);
-    break;
-  case ANDROID_home:
-    sendRawKey(0x04, 0x29);
-    break;
-  case ANDROID_menu:
-    sendRawKey(0x10, 0x29);
-    break;
-  case ANDROID_back:
-    sendRawKey(0x00, 0x29);
-    break;
-  case ANDROID_dpadcenter:
-    sendRawKey(0x00, 0x5D);
-    break;
-  case MEDIA_playpause:
-    sendControlKey("PLAYPAUSE");
-    break;
-  case MEDIA_stop:
-    sendControlKey("MEDIASTOP");
-    break;
-  case MEDIA_next:
-    sendControlKey("MEDIANEXT");
-    break;
-  case MEDIA_previous:
-    sendControlKey("MEDIAPREVIOUS");
-    break;
-  case MEDIA_volup:
-    sendControlKey("VOLUME+,500");
-    break;
-  case MEDIA_voldn:
-    sendControlKey("VOLUME-,500");
-    break;
-  // Send the key
-  default:
-    sendRawKey(modKeys, theKey);
-    break;
-  }
-
-  modKeys = 0x00;
-  mode = ALPHA;
-  // Reset the modKeys and mode based on locks
-  if (isCapsLocked){
-    modKeys = 0x02;
-  }
-  if (isNumsymLocked){
-    mode = NUMSYM;
-  }
+    ESP_LOGI(__FUNCTION__,"Successfully set up GPIO pin %d interrupt", pinnum);
 }
+#endif
 
-void handle_keystate_update_as_ble_mouse(uint8_t keyState){
-  static size_t jump = 8;
-  keymap_t theKey;  
+uint8_t get_current_state ()
+{
+    // Sample all keys in one go, rather than pin by pin through the driver,
+    // so that a chord can't be caught half-pressed:
+    uint32_t in = REG_READ(GPIO_IN_REG);
+    uint32_t in1 = REG_READ(GPIO_IN1_REG);
+    return keystate_from_gpio_in(in, in1);
+}
 
-  display_timeout_last_activity = xTaskGetTickCount();
-  theKey = keymap[keyState][3];
-  static keymap_t lastKey = 0;
-  
-  if (lastKey == theKey) {
-    jump = 127 > 3 * jump ? 3 * jump : 127;
-  } else {
-    jump = 1;
-  }
+#if CONFIG_CHORDER_ADVISOR
+#if CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO >= 0
+static esp_timer_handle_t haptic_timer;
 
-  lastKey = theKey;
-
-  switch (theKey)  {
-    case MODE_NOTETAKING:
-      jump = 8;
-      switch_to_opmode(OPMODE_NOTETAKING);
-      return;
-    case MODE_BLE_KEYBOARD:
-      jump = 8;
-      switch_to_opmode(OPMODE_BLE_KEYBOARD);
-      return;
-    case BLEMOUSE_LEFT:
-      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,-jump,0,0);
-      break;
-    case BLEMOUSE_DOWN:
-      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,0,-jump,0);
-      break;
-    case BLEMOUSE_UP:
-      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,0,jump,0);
-      break;
-    case BLEMOUSE_RIGHT:
-      if (sec_conn) esp_hidd_send_mouse_value(hid_conn_id,0,jump,0,0);
-      break;
-    case BLEMOUSE_1CLICK:
-      if (sec_conn) {
-        esp_hidd_send_mouse_value(hid_conn_id,1,0,0,0);
-        esp_hidd_send_mouse_value(hid_conn_id,0,0,0,0);
-      }
-      break;
-    default:
-      strcpy(lcd_state.alert,"Unknown\nkey");
-      break;
-  }
+static void haptic_off (void *arg)
+{
+  gpio_set_level(CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO, 0);
+}
+#endif
 
-  modKeys = 0x00;
-  mode = ALPHA;
-  // Reset the modKeys and mode based on locks
-  if (isCapsLocked){
-    modKeys = 0x02;
-  }
-  if (isNumsymLocked){
-    mode = NUMSYM;
-  }
+void advisor_output_init (void)
+{
+#if CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO >= 0
+  gpio_reset_pin(CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO);
+  gpio_set_direction(CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO, GPIO_MODE_OUTPUT);
+  gpio_set_level(CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO, 0);
+  const esp_timer_create_args_t haptic_timer_args = {
+    .callback = haptic_off,
+    .name = "haptic_off",
+  };
+  ESP_ERROR_CHECK(esp_timer_create(&haptic_timer_args, &haptic_timer));
+#endif
 }
 
-void switch_to_opmode(enum Operating_mode target){
-  static int last_opmode = -1;
-  switch(last_opmode) {
-    case OPMODE_BLE_KEYBOARD:
-      ESP_LOGI(__FUNCTION__, "Coming out of BLE Keyboard mode; releasing keys");
-      release_keys();
-      break;
-    default:
-      break;
-  }
-  switch(target) {
-    case OPMODE_NOTETAKING:
-      keystate_handler = &handle_keystate_update_internally_with_printing;
-      lcd_style.background_color = DARK_RED;
-      break;
-    case OPMODE_BLE_KEYBOARD:
-      keystate_handler = &handle_keystate_update_as_ble_keyboard;
-      mode = ALPHA;
-      modKeys = 0x00;
-      isCapsLocked = false;
-      isNumsymLocked = false;
-      lcd_style.background_color = BLUE;
-      break;
-    case OPMODE_BLE_MOUSE:
-      keystate_handler = &handle_keystate_update_as_ble_mouse;
-      lcd_style.background_color = CYAN;
-      break;
-    default:
-      ESP_LOGE(__FUNCTION__,"Wrong switch_to_mode chosen.");
-  }
-  last_opmode = target;
+// Hints at the keys that could have been held over; only flags things for
+// the display task, and buzzes without waiting for the buzz to end:
+static void advisor_alert (uint8_t keys)
+{
+  lcd_state.hint_keys = keys;
+#if CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO >= 0
+  gpio_set_level(CONFIG_CHORDER_ADVISOR_HAPTIC_GPIO, 1);
+  esp_timer_stop(haptic_timer);
+  esp_timer_start_once(haptic_timer, CONFIG_CHORDER_ADVISOR_HAPTIC_MS * 1000);
+#endif
 }
+#endif
 
 // }}}
 
@@ -972,6 +606,10 @@ void switch_to_opmode(enum Operating_mode target){
 ////////////////////////////////////////////////////////////////////////////////
 // {{{
 
+// Debounced keyStates, from the scanner task to the decoder task:
+static key_event_ring_t key_events;
+static TaskHandle_t key_decode_task = NULL;
+
 void sleep_mode_task (void *pvParameters)
 {
   if (0 == display_timeout_last_activity)
@@ -982,6 +620,13 @@ void sleep_mode_task (void *pvParameters)
 
     int ms_since_last_update = (xTaskGetTickCount()-display_timeout_last_activity)*portTICK_PERIOD_MS;
 
+#if CONFIG_CHORDER_USAGE_STATS
+    // Writing out once typing pauses batches up flash writes, without
+    // holding up keys being typed:
+    if (ms_since_last_update > CONFIG_CHORDER_USAGE_FLUSH_IDLE_S * 1000) {
+      usage_flush();
+    }
+#endif
     if (ms_since_last_update > MS_BEFORE_SLEEP) {
       send_chorder_to_sleep();
     }
@@ -990,16 +635,23 @@ void sleep_mode_task (void *pvParameters)
 
 void watch_for_key_changes (void *pvParameters)
 {
-    uint8_t lastKeyState = 0;
-    bool have_seen_first_stable_reading = false;
-
-    int64_t lastDebounceTime = 0;  // the last time inputs changed
-    int64_t debounceDelay = 10000; // the debounce time; increase if the output flickers
-
-    uint8_t previousStableReading = 0;
-    uint8_t currentStableReading = 0;
-
-    enum State state = RELEASING;
+    // Release debounce windows per keyState bit; increase if the output flickers:
+    const int32_t debounce_windows[DEBOUNCE_KEYS] = {
+      [PINKY_BIT]   = PINKY_DEBOUNCE_US,
+      [RING_BIT]    = RING_DEBOUNCE_US,
+      [MIDDLE_BIT]  = MIDDLE_DEBOUNCE_US,
+      [INDEX_BIT]   = INDEX_DEBOUNCE_US,
+      [N_THUMB_BIT] = N_THUMB_DEBOUNCE_US,
+      [C_THUMB_BIT] = C_THUMB_DEBOUNCE_US,
+      [F_THUMB_BIT] = F_THUMB_DEBOUNCE_US,
+    };
+    debouncer_t debouncer;
+    debounce_init(&debouncer, debounce_windows);
+
+    uint8_t stableReading = 0;
+#if CONFIG_CHORDER_TRACE
+    uint8_t lastRecordedState = 0;
+#endif
 
     set_up_gnd_pin(GND_PIN0);
     set_up_gnd_pin(GND_PIN1);
@@ -1014,70 +666,265 @@ void watch_for_key_changes (void *pvParameters)
     set_up_input_pin(RING_PIN);
     set_up_input_pin(PINKY_PIN);
 
+#if CONFIG_CHORDER_KEYSCAN_INTERRUPT
+    key_scan_task = xTaskGetCurrentTaskHandle();
+    if (ESP_OK != gpio_install_isr_service(0))
+    {
+        ESP_LOGE(__FUNCTION__,"Failure installing GPIO ISR service");
+    }
+    set_up_input_pin_interrupt(F_THUMB_PIN, F_THUMB_BIT);
+    set_up_input_pin_interrupt(C_THUMB_PIN, C_THUMB_BIT);
+    set_up_input_pin_interrupt(N_THUMB_PIN, N_THUMB_BIT);
+    set_up_input_pin_interrupt(INDEX_PIN,   INDEX_BIT);
+    set_up_input_pin_interrupt(MIDDLE_PIN,  MIDDLE_BIT);
+    set_up_input_pin_interrupt(RING_PIN,    RING_BIT);
+    set_up_input_pin_interrupt(PINKY_PIN,   PINKY_BIT);
+    int64_t edge_times[DEBOUNCE_KEYS];
+#endif
+
     while (1) {
         // Build the current key state.
         uint8_t keyState = get_current_state();
+#if CONFIG_CHORDER_TRACE
+        if (keyState != lastRecordedState) {
+            trace_record(esp_timer_get_time(), keyState);
+            lastRecordedState = keyState;
+        }
+#endif
 
-        if (lastKeyState != keyState) {
-            lastDebounceTime = esp_timer_get_time();
+        // Hand any change over to the decoder, stamped with the physical
+        // edge behind it; never block on its output:
+#if CONFIG_CHORDER_KEYSCAN_INTERRUPT
+        // Every edge restarts its key's debounce window, even ones that have
+        // bounced back by the time we get to read the pins:
+        get_last_edge_times(edge_times);
+        if (keyscan_step(&debouncer, &stableReading, keyState, edge_times, esp_timer_get_time(), &key_events))
+            xTaskNotifyGive(key_decode_task);
+#else
+        if (keyscan_step(&debouncer, &stableReading, keyState, NULL, esp_timer_get_time(), &key_events))
+            xTaskNotifyGive(key_decode_task);
+#endif
+#if CONFIG_CHORDER_KEYSCAN_INTERRUPT
+        // Sleep until the next edge; if a release is still settling, wake
+        // again once its debounce window has passed to pick it up:
+        TickType_t ticks_to_wait = portMAX_DELAY;
+        int64_t settles_at = debounce_next_deadline(&debouncer);
+        if (-1 != settles_at) {
+            int64_t us_left = settles_at - esp_timer_get_time();
+            ticks_to_wait = us_left > 0 ? pdMS_TO_TICKS(us_left / 1000) + 1 : 1;
         }
+        ulTaskNotifyTake(pdTRUE, ticks_to_wait);
+#else
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+#endif
+    }
+}
+
+#if CONFIG_CHORDER_TYPEMATIC
+// Wakes the decoder (passed as arg) for a repeat that's due, to the
+// microsecond rather than to the tick:
+static void typematic_wake (void *arg)
+{
+    xTaskNotifyGive((TaskHandle_t) arg);
+}
+#endif
 
-        if ((esp_timer_get_time() - lastDebounceTime) > debounceDelay) {
-            // whatever the reading is at, it's been there for longer
-            // than the debounce delay, so take it as the actual current state:
-            currentStableReading = keyState;
+// Waits for the snippet task to let go of the snippet being typed out, and
+// of those queued behind it:
+static void cancel_snippets (void)
+{
+    snippet_cancel();
+    while (snippet_pending())
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+void decode_key_events (void *pvParameters)
+{
+    uint32_t reported_overflows = 0;
+
+    chord_machine_t chord_machine;
+#if CONFIG_CHORDER_COMMIT_ROLLOVER
+    chord_machine_init(&chord_machine, CHORD_COMMIT_ROLLOVER, CONFIG_CHORDER_ROLLOVER_WINDOW_US);
+#else
+    chord_machine_init(&chord_machine, CHORD_COMMIT_FIRST_RELEASE, 0);
+#endif
+#if CONFIG_CHORDER_SPECULATIVE_COMMIT
+    chord_machine_set_speculation(&chord_machine, CONFIG_CHORDER_SPECULATE_AFTER_US);
+#endif
+#if CONFIG_CHORDER_TAPHOLD
+    taphold_t taphold;
+    taphold_init(&taphold, CONFIG_CHORDER_HOLD_US);
+#endif
+#if CONFIG_CHORDER_TYPEMATIC
+    typematic_t typematic;
+    typematic_init(&typematic, CONFIG_CHORDER_TYPEMATIC_DELAY_MS * 1000, CONFIG_CHORDER_TYPEMATIC_INTERVAL_MS * 1000);
+    const esp_timer_create_args_t typematic_timer_args = {
+      .callback = typematic_wake,
+      .arg = xTaskGetCurrentTaskHandle(),
+      .name = "typematic",
+    };
+    esp_timer_handle_t typematic_timer;
+    ESP_ERROR_CHECK(esp_timer_create(&typematic_timer_args, &typematic_timer));
+    int64_t typematic_armed_for = -1;
+#endif
+#if CONFIG_CHORDER_CONN_PARAMS
+    connparams_init(xTaskGetCurrentTaskHandle());
+#endif
+
+    while (1) {
+        // Sleep until the next key event, or until the chord being pressed
+        // has been held still for long enough to speculate on, or to count
+        // as a tap-hold chord's hold:
+        TickType_t ticks_to_wait = portMAX_DELAY;
+        int64_t wake_at = chord_machine_speculation_deadline(&chord_machine);
+#if CONFIG_CHORDER_TAPHOLD
+        int64_t hold_at = hold_roles_apply() ? taphold_deadline(&taphold) : -1;
+        if (-1 != hold_at && (-1 == wake_at || hold_at < wake_at))
+            wake_at = hold_at;
+#endif
+#if CONFIG_CHORDER_CONN_PARAMS
+        // Or until it's been idle long enough to relax the connection:
+        int64_t idle_at = connparams_deadline();
+        if (-1 != idle_at && (-1 == wake_at || idle_at < wake_at))
+            wake_at = idle_at;
+#endif
+        if (-1 != wake_at) {
+            int64_t us_left = wake_at - esp_timer_get_time();
+            ticks_to_wait = us_left > 0 ? pdMS_TO_TICKS(us_left / 1000) + 1 : 0;
+        }
+        // A snippet being typed out holds off everything but key events,
+        // until the snippet task says it's done:
+        if (snippet_pending())
+            ticks_to_wait = portMAX_DELAY;
+        ulTaskNotifyTake(pdTRUE, ticks_to_wait);
+        // Reports held back for room in the HID transmit queue go first:
+        hid_tx_admit();
+
+        if (reported_overflows != key_event_ring_overflows(&key_events)) {
+            reported_overflows = key_event_ring_overflows(&key_events);
+            ESP_LOGW(__FUNCTION__, "Key event ring overflowed; %u events dropped in total", (unsigned) reported_overflows);
         }
 
-        if (previousStableReading != currentStableReading) {
-            //Serial.print(F("currentStableReading now "));
-            //Serial.println(currentStableReading);
-            ESP_LOGD(__FUNCTION__, "New reading: %s%s%s %s%s%s%s",
-                currentStableReading & (1 << 6) ? "F" : "_",
-                currentStableReading & (1 << 5) ? "C" : "_",
-                currentStableReading & (1 << 4) ? "N" : "_",
-                currentStableReading & (1 << 3) ? "I" : "_",
-                currentStableReading & (1 << 2) ? "M" : "_",
-                currentStableReading & (1 << 1) ? "R" : "_",
-                currentStableReading & (1 << 0) ? "P" : "_"
-            );
-            if (! have_seen_first_stable_reading)
-            {
-            /*
-                bool are_thumbs_down = 0x70 == currentStableReading;
-                if (are_thumbs_down)
+        // Taken even while a snippet is typed out, for the ring not to
+        // overflow behind a long one:
+        key_event_t event;
+        while (key_event_ring_pop(&key_events, &event)) {
+            uint8_t keyState = event.keyState;
+#if CONFIG_CHORDER_CONN_PARAMS
+            // Ahead of the chord being decoded, for the interval to have
+            // shortened by the time it goes out, or not long after:
+            connparams_activity(event.timestamp);
+#endif
+#if CONFIG_CHORDER_TAPHOLD
+            // Keys of a held tap-hold chord are left out of chords:
+            uint8_t released;
+            keyState = taphold_feed(&taphold, keyState, event.timestamp, &released);
+            if (0 != released)
+                handle_hold(released, false);
+#endif
+            uint8_t chord = chord_machine_feed(&chord_machine, keyState, event.timestamp);
+            uint8_t typed = 0;
+#if CONFIG_CHORDER_TYPEMATIC
+            // Any change stops a repeat, and a chord already typed as held
+            // isn't typed again as it's let go of:
+            typed = typematic_hold(&typematic, 0, event.timestamp);
+#endif
+#if CONFIG_CHORDER_USAGE_STATS
+            // On the layer it's about to be looked up on:
+            if (0 != chord)
+                usage_count(current_layer(), chord);
+#endif
+            // A chord typed over a snippet stops it, rather than coming out
+            // in the middle of it:
+            if (0 != chord && snippet_pending())
+                cancel_snippets();
+            // Nothing more to send if the chord's key went out speculatively:
+            if (0 != chord && chord != typed && ! settle_speculation(chord)) {
+                latency_mark_edge(event.timestamp);
+                latency_mark_decode();
+                // First, let the opmode_switch_handler react. If it does nothing, proceed:
+                if (! opmode_switch_and_deepsleep_handler(chord))
                 {
-                    ESP_LOGI(__FUNCTION__, "Performing a BT factory reset: ");
-                    if ( ! ble.factoryReset() ){
-                        ESP_LOGW(__FUNCTION__, "Factory reset failed!");
-                    }
-                    ESP_LOGI(__FUNCTION__, "Resetting Arduino...");
-                    resetFunc();
+                    (*keystate_handler)(chord);
                 }
-            */
             }
-            have_seen_first_stable_reading = true;
-            switch (state) {
-              case PRESSING:
-                if (previousStableReading & ~currentStableReading) {
-                  state = RELEASING;
-                  // First, let the opmode_switch_handler react. If it does nothing, proceed:
-                  if (! opmode_switch_and_deepsleep_handler(previousStableReading))
-                  {
-                    (*keystate_handler)(previousStableReading);
-                  }
-                } 
-                break;
-
-              case RELEASING:
-                if (currentStableReading & ~previousStableReading) {
-                  state = PRESSING;
-                }
-                break;
+            // Only once the chord's been looked up, with any momentary layer
+            // it was typed on:
+            handle_keys_held(event.keyState);
+#if CONFIG_CHORDER_ADVISOR
+            // Only judged once the chord's been sent, so as not to hold it up:
+            if (0 != chord) {
+                uint8_t hint = advisor_commit(&advisor, chord, event.timestamp);
+                if (0 != hint)
+                    advisor_alert(hint);
             }
-            previousStableReading = currentStableReading;
+            advisor_keys(&advisor, keyState);
+#endif
+        }
+
+        // Nothing's typed for a chord being held while a snippet is out:
+        if (snippet_pending())
+            continue;
+#if CONFIG_CHORDER_CONN_PARAMS
+        connparams_poll(esp_timer_get_time());
+#endif
+#if CONFIG_CHORDER_TAPHOLD
+        if (hold_roles_apply()) {
+            int64_t now = esp_timer_get_time();
+            uint8_t held = taphold_resolve(&taphold, now);
+            if (0 != held) {
+                // Its keys are now out of chords, and it mustn't commit on release:
+                chord_machine_restart(&chord_machine, 0, now);
+                handle_hold(held, true);
+            }
+        }
+#endif
+#if CONFIG_CHORDER_TYPEMATIC
+        {
+            // The chord held still, if it repeats; a tap-hold chord held
+            // still may yet turn out to be a hold, so doesn't:
+            uint8_t still = PRESSING == chord_machine.state && typematic_applies(chord_machine.previous) ? chord_machine.previous : 0;
+#if CONFIG_CHORDER_TAPHOLD
+            if (hold_roles_apply() && 0 != taphold.candidate)
+                still = 0;
+#endif
+            typematic_hold(&typematic, still, chord_machine.last_change);
+            int64_t now = esp_timer_get_time();
+            bool first = 0 == typematic.typed;
+            if (typematic_due(&typematic, now) && ! typematic_type(typematic.chord, first))
+                typematic_stop(&typematic);
+#if CONFIG_CHORDER_CONN_PARAMS
+            // Repeats being typed keep the connection tuned for typing:
+            if (0 != typematic.typed && ! typematic.stopped)
+                connparams_activity(now);
+#endif
+
+            int64_t due_at = typematic_deadline(&typematic);
+            if (due_at != typematic_armed_for) {
+                esp_timer_stop(typematic_timer);
+                if (-1 != due_at)
+                    esp_timer_start_once(typematic_timer, due_at > now ? due_at - now : 1);
+                typematic_armed_for = due_at;
+            }
+        }
+#endif
+#if CONFIG_CHORDER_TAPHOLD
+        // A tap-hold chord held still isn't speculated on, as it may yet be a hold:
+        if (0 != taphold.candidate)
+            continue;
+#endif
+#if CONFIG_CHORDER_TYPEMATIC
+        // Nor is one that's already been typed as held:
+        if (0 != typematic.typed)
+            continue;
+#endif
+        int64_t held_since = chord_machine.last_change;
+        uint8_t likely_chord = chord_machine_speculate(&chord_machine, esp_timer_get_time());
+        if (0 != likely_chord) {
+            latency_mark_edge(held_since);
+            latency_mark_decode();
+            speculate_keystate(likely_chord);
         }
-        lastKeyState = keyState;
-        vTaskDelay(10 / portTICK_PERIOD_MS);
     }
 }
 
@@ -1110,10 +957,36 @@ void app_main(void)
     // Start rendering tasks before wifi, to allow early key pressing etc:
 
     // Chorder setup
+    keymap_partition_load();
+    dict_partition_load(&dictionary);
+#if CONFIG_CHORDER_USAGE_STATS
+    usage_load();
+#endif
+#if CONFIG_CHORDER_ADVISOR
+    advisor_init(&advisor, CONFIG_CHORDER_ADVISOR_WINDOW_MS * 1000);
+    advisor_output_init();
+#endif
+    hid_tx_init();
     switch_to_opmode(OPMODE_NOTETAKING);
 
     xTaskCreate(render_display_task, "render_display_task", 1024*3, NULL, 2, NULL);
-    xTaskCreate(watch_for_key_changes, "watch_for_key_changes", 1024*6, NULL, 2, NULL);
+    // The decoder owns the (potentially slow) output handlers; the scanner
+    // runs at a higher priority so that output never holds up scanning:
+    xTaskCreate(decode_key_events, "decode_key_events", 1024*6, NULL, 2, &key_decode_task);
+    xTaskCreate(watch_for_key_changes, "watch_for_key_changes", 1024*3, NULL, 3, NULL);
+    // Snippets are typed out below the decoder, which holds its own output
+    // off until they're done:
+    TaskHandle_t snippet_streamer;
+    xTaskCreate(snippet_task, "snippet_task", 1024*2, key_decode_task, 1, &snippet_streamer);
+    // ... and it alone blocks on the transmit queue; the decoder's reports
+    // wait for room in a backlog instead:
+    hid_tx_set_bulk_sender(snippet_streamer);
+    hid_tx_set_decoder(key_decode_task);
+    // Reports go out through the transmit queue, above both that fill it:
+    xTaskCreate(hid_tx_task, "hid_tx_task", 1024*3, NULL, 4, NULL);
+#if CONFIG_CHORDER_TRACE
+    xTaskCreate(trace_writer_task, "trace_writer_task", 1024*3, NULL, 1, NULL);
+#endif
 
 
     // Initialize NVS.
@@ -1170,15 +1043,23 @@ void app_main(void)
     } else ESP_LOGI("MAIN","bt device name is: %s",config.bt_device_name);
 
     ret = nvs_get_u8(my_handle, "locale", &config.locale);
-    //if(ret != ESP_OK || config.locale >= LAYOUT_MAX)
-    ///@todo implement keyboard layouts.
-    if(ret != ESP_OK)
+    if(ret != ESP_OK || config.locale >= LOCALES)
     {
-        ESP_LOGI("MAIN","error reading NVS - locale, setting to US_INTERNATIONAL");
-        //config.locale = LAYOUT_US_INTERNATIONAL;
+        ESP_LOGI("MAIN","error reading NVS - locale, setting to US");
+        config.locale = LOCALE_US;
     } else ESP_LOGI("MAIN","locale code is : %d",config.locale);
+
+    ret = nvs_get_u8(my_handle, "unicode", &config.unicode);
+    if(ret != ESP_OK || config.unicode >= UNICODE_METHODS)
+    {
+        ESP_LOGI("MAIN","error reading NVS - unicode, setting to none");
+        config.unicode = UNICODE_NONE;
+    } else ESP_LOGI("MAIN","unicode input method is : %d",config.unicode);
     nvs_close(my_handle);
-    ///@todo How to handle the locale here? We have the memory for full lookups on the ESP32, but how to communicate this with the Teensy?
+    // Text (snippets, macros, dictionary words) is typed for the host's layout,
+    // and what that has no key for through its Unicode input method:
+    locale_select(config.locale);
+    unicode_select(config.unicode);
 
     ///register the callback function to the gap module
     esp_ble_gap_register_callback(gap_event_handler);